@@ -55,4 +55,11 @@ CONFIG=Debug
 # NOTE: Check the JSON file for the command parameters
 COMBINE_SIGN_JSON?=configs/boot_with_extended_boot.json
 
+# Set to 1 to record the cross-core event trace in the CM33 secure, CM33
+# non-secure and CM55 applications. Merge the buffers with tools/trace_merge.py.
+TRACE_TIMELINE?=0
+ifeq ($(TRACE_TIMELINE),1)
+DEFINES+=TRACE_TIMELINE
+endif
+
 include ../common_app.mk
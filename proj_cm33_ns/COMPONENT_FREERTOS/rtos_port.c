@@ -0,0 +1,258 @@
+/*******************************************************************************
+ * File Name:   rtos_port.c
+ *
+ * Description: This file contains the FreeRTOS port layer of the non-secure
+ *              application. It serializes the USER SRF requests made by the
+ *              tasks with a recursive mutex, and implements tickless idle on
+ *              the CM33 LPTimer: SysTick is stopped for the idle period, the
+ *              CPU sleeps in CPU Sleep or Deep Sleep depending on the length
+ *              of the period, and the tick count is stepped by the time slept.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "user_srf.h"
+#include "event_sched_port.h"
+#include "tickless.h"
+#include "rtos_port.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* LPTimer ticks to wake up before the next task is due, covers the Deep Sleep
+ * exit */
+#define RTOS_PORT_WAKE_LEAD         (2UL)
+
+/* Idle periods shorter than this keep the tick running. The LPTimer match
+ * needs a few ticks of lead to be armed. */
+#define RTOS_PORT_MIN_SLEEP         (4UL)
+
+/* The last count of a SysTick period, a reload of 0 stops the counter */
+#define RTOS_PORT_MIN_PERIOD        (2UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Serializes the USER SRF requests of the tasks */
+static SemaphoreHandle_t rtos_port_srf_mutex = NULL;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: rtos_port_srf_acquire
+********************************************************************************
+* Summary:
+*  Takes the USER SRF lock. Before the scheduler starts, and while it is
+*  suspended for the tickless idle sleep, the caller already runs alone.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void rtos_port_srf_acquire(void)
+{
+    if (taskSCHEDULER_RUNNING == xTaskGetSchedulerState())
+    {
+        /* SRF requests are not allowed from interrupts */
+        configASSERT(pdFALSE == xPortIsInsideInterrupt());
+
+        (void)xSemaphoreTakeRecursive(rtos_port_srf_mutex, portMAX_DELAY);
+    }
+}
+
+/*******************************************************************************
+* Function Name: rtos_port_srf_release
+********************************************************************************
+* Summary:
+*  Gives back the USER SRF lock.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void rtos_port_srf_release(void)
+{
+    if (taskSCHEDULER_RUNNING == xTaskGetSchedulerState())
+    {
+        (void)xSemaphoreGiveRecursive(rtos_port_srf_mutex);
+    }
+}
+
+static const cy_stc_user_srf_lock_t rtos_port_srf_lock =
+{
+    .acquire = rtos_port_srf_acquire,
+    .release = rtos_port_srf_release
+};
+
+/*******************************************************************************
+* Function Name: rtos_port_init
+********************************************************************************
+* Summary:
+*  Installs the USER SRF lock and starts the LPTimer used for tickless idle.
+*  Called before the scheduler is started.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void rtos_port_init(void)
+{
+    rtos_port_srf_mutex = xSemaphoreCreateRecursiveMutex();
+    configASSERT(NULL != rtos_port_srf_mutex);
+
+    cy_user_srf_set_lock(&rtos_port_srf_lock);
+
+    event_sched_port_init();
+}
+
+/*******************************************************************************
+* Function Name: rtos_port_suppress_ticks_and_sleep
+********************************************************************************
+* Summary:
+*  Tickless idle hook, called by the idle task with the scheduler suspended.
+*  Stops SysTick, sleeps until the LPTimer match set at the expected wake-up
+*  or until another interrupt, and steps the tick count by the time slept.
+*  SysTick is restarted so that the next tick keeps the phase of the ticks
+*  before the sleep. SRF requests skip the lock while the scheduler is
+*  suspended, so the CPU only sleeps in CPU Sleep while a blocked task owns
+*  the lock: Deep Sleep is entered with an SRF request of its own.
+*
+* Parameters:
+*  expected_idle - ticks until the next task unblocks
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void rtos_port_suppress_ticks_and_sleep(TickType_t expected_idle)
+{
+    const event_sched_port_t* port = &event_sched_lptimer_port;
+    tickless_cfg_t cfg;
+    tickless_step_t step;
+    uint32_t reload;
+    uint32_t elapsed;
+    uint32_t sleep;
+    uint32_t start;
+    uint32_t slept = 0UL;
+    bool srf_owned;
+
+    /* Interrupts stay pending while masked, the one that ends the sleep runs
+     * once the tick is restarted */
+    __disable_irq();
+
+    if (eAbortSleep == eTaskConfirmSleepModeStatus())
+    {
+        __enable_irq();
+        return;
+    }
+
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+    /* A tick that expired meanwhile is handled as usual */
+    if (0UL != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk))
+    {
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+        __enable_irq();
+        return;
+    }
+
+    reload = SysTick->LOAD + 1UL;
+    elapsed = SysTick->LOAD - SysTick->VAL;
+
+    cfg.tick_counts = reload;
+    cfg.counts_hz = SystemCoreClock;
+    cfg.wake_hz = EVENT_SCHED_PORT_HZ;
+    cfg.wake_lead = RTOS_PORT_WAKE_LEAD;
+    cfg.min_sleep = RTOS_PORT_MIN_SLEEP;
+
+    sleep = tickless_sleep_ticks(&cfg, (uint32_t)expected_idle, elapsed);
+    start = port->now();
+
+    if ((0UL != sleep) && port->set_wakeup(start + sleep))
+    {
+        srf_owned = (NULL != xSemaphoreGetMutexHolder(rtos_port_srf_mutex));
+        if (srf_owned)
+        {
+            event_sched_port_hold_ds(true);
+        }
+
+        port->idle(sleep);
+        slept = port->now() - start;
+
+        if (srf_owned)
+        {
+            event_sched_port_hold_ds(false);
+        }
+    }
+
+    step = tickless_step(&cfg, (uint32_t)expected_idle, elapsed, slept);
+
+    if (step.next_counts < RTOS_PORT_MIN_PERIOD)
+    {
+        SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+        step.next_counts = reload;
+    }
+
+    /* The first period ends at the next tick boundary, the following ones use
+     * the full reload again */
+    SysTick->LOAD = step.next_counts - 1UL;
+    SysTick->VAL = 0UL;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    SysTick->LOAD = reload - 1UL;
+
+    vTaskStepTick((TickType_t)step.ticks);
+
+    __enable_irq();
+}
+
+/* [] END OF FILE */
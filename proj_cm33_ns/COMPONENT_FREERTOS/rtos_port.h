@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * File Name:   rtos_port.h
+ *
+ * Description: This file is the public interface of rtos_port.c, the FreeRTOS
+ *              port layer of the non-secure application. It is built when
+ *              FREERTOS is added to COMPONENTS.
+ *
+ *              The tickless idle hook is installed from FreeRTOSConfig.h:
+ *
+ *                  #define configUSE_TICKLESS_IDLE     (2)
+ *                  #define portSUPPRESS_TICKS_AND_SLEEP(idle) \
+ *                      rtos_port_suppress_ticks_and_sleep(idle)
+ *                  #define INCLUDE_xSemaphoreGetMutexHolder    (1)
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _RTOS_PORT_H_
+#define _RTOS_PORT_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "FreeRTOS.h"
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void rtos_port_init(void);
+void rtos_port_suppress_ticks_and_sleep(TickType_t expected_idle);
+
+#endif /* _RTOS_PORT_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,313 @@
+/*******************************************************************************
+ * File Name:   cm55_offload.c
+ *
+ * Description: This file contains the CM55 compute offload demonstration. A
+ *              scheduler timer queues a signal energy job in the shared job
+ *              ring periodically. The doorbell is rung once per batch, or by
+ *              a flush timer for an incomplete batch, so the CM55 wakes once
+ *              for several jobs while the CM33 stays in its low-power mode.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cm55_offload.h"
+
+#if defined(CM55_OFFLOAD_DEMO)
+
+#include "cybsp.h"
+#include "event_sched_port.h"
+#include "ipc_shared.h"
+#include "ipc_doorbell.h"
+#include "job_ring.h"
+#include "log_token.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Interval between two jobs */
+#define CM55_OFFLOAD_JOB_MSEC       (250U)
+
+/* Jobs queued before the CM55 is woken up */
+#define CM55_OFFLOAD_BATCH          (4U)
+
+/* Longest time a job waits for its batch to fill up */
+#define CM55_OFFLOAD_FLUSH_MSEC     (1500U)
+
+/* Samples per job, the jobs walk through the job data area */
+#define CM55_OFFLOAD_WINDOW         (64U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static event_sched_t* offload_sched;
+static event_sched_timer_t job_timer;
+static event_sched_timer_t flush_timer;
+
+/* Producer side of the job ring */
+static job_ring_producer_t job_producer;
+
+/* Jobs queued, also the sequence number of the next job */
+static uint32_t job_count = 0UL;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: wake_cm55
+********************************************************************************
+* Summary:
+* Rings the CM55 doorbell for the queued batch.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void wake_cm55(void)
+{
+    event_sched_timer_stop(offload_sched, &flush_timer);
+    ipc_doorbell_ring(IPC_DOORBELL_CM55);
+}
+
+/*******************************************************************************
+* Function Name: flush_timer_cb
+********************************************************************************
+* Summary:
+* Scheduler timer callback, wakes the CM55 for an incomplete batch.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void flush_timer_cb(void* arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    if (job_ring_flush(&job_producer))
+    {
+        wake_cm55();
+    }
+}
+
+/*******************************************************************************
+* Function Name: job_timer_cb
+********************************************************************************
+* Summary:
+* Scheduler timer callback, queues the next job. Each job owns the result slot
+* of its ring slot, so results are not overwritten while the job is queued.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void job_timer_cb(void* arg)
+{
+    uint32_t window = job_count % (IPC_JOB_SAMPLES / CM55_OFFLOAD_WINDOW);
+    job_ring_job_t job =
+    {
+        .op = IPC_JOB_OP_ENERGY,
+        .in = IPC_SHARED_OFFSET(job_samples) + (window * CM55_OFFLOAD_WINDOW * sizeof(int16_t)),
+        .in_len = CM55_OFFLOAD_WINDOW * sizeof(int16_t),
+        .out = IPC_SHARED_OFFSET(job_results) + ((job_count & (JOB_RING_LEN - 1U)) * sizeof(uint64_t)),
+        .out_len = sizeof(uint64_t)
+    };
+
+    CY_UNUSED_PARAMETER(arg);
+
+    switch (job_ring_push(&job_producer, &job, NULL))
+    {
+        case JOB_RING_SIGNAL:
+            job_count++;
+            wake_cm55();
+            break;
+
+        case JOB_RING_QUEUED:
+            job_count++;
+            if (!flush_timer.active)
+            {
+                event_sched_timer_start(offload_sched, &flush_timer, EVENT_SCHED_MS_TO_TICKS(CM55_OFFLOAD_FLUSH_MSEC),
+                                        0UL, flush_timer_cb, NULL);
+            }
+            break;
+
+        default:
+            /* The CM55 is behind, make sure it is awake */
+            (void)job_ring_flush(&job_producer);
+            wake_cm55();
+            break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: cm55_offload_init
+********************************************************************************
+* Summary:
+* Fills the job data area with a test signal and attaches to the job ring. The
+* job ring must have been initialized before the CM55 was started.
+*
+* Parameters:
+*  sched - scheduler running the demonstration
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cm55_offload_init(event_sched_t* sched)
+{
+    /* Triangle wave with a period of one job window */
+    for (uint32_t i = 0U; i < IPC_JOB_SAMPLES; i++)
+    {
+        int32_t phase = (int32_t)(i % CM55_OFFLOAD_WINDOW) - (int32_t)(CM55_OFFLOAD_WINDOW / 2U);
+
+        IPC_SHARED->job_samples[i] = (int16_t)(((phase < 0) ? -phase : phase) * 64);
+    }
+    ipc_shared_publish(IPC_SHARED->job_samples, sizeof(IPC_SHARED->job_samples));
+
+    offload_sched = sched;
+    job_ring_producer_init(&job_producer, &IPC_SHARED->jobs, CM55_OFFLOAD_BATCH,
+                           ipc_shared_publish, ipc_shared_fetch);
+}
+
+/*******************************************************************************
+* Function Name: cm55_offload_start
+********************************************************************************
+* Summary:
+* Starts queuing jobs.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cm55_offload_start(void)
+{
+    event_sched_timer_start(offload_sched, &job_timer, EVENT_SCHED_MS_TO_TICKS(CM55_OFFLOAD_JOB_MSEC),
+                            EVENT_SCHED_MS_TO_TICKS(CM55_OFFLOAD_JOB_MSEC), job_timer_cb, NULL);
+}
+
+/*******************************************************************************
+* Function Name: cm55_offload_stop
+********************************************************************************
+* Summary:
+* Stops queuing jobs. Queued jobs are handed to the CM55.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cm55_offload_stop(void)
+{
+    event_sched_timer_stop(offload_sched, &job_timer);
+    flush_timer_cb(NULL);
+}
+
+/*******************************************************************************
+* Function Name: cm55_offload_completed
+********************************************************************************
+* Summary:
+* Reports the jobs completed by the CM55 and the ring statistics. Called when
+* the CM55 rings the CM33 doorbell.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cm55_offload_completed(void)
+{
+    job_ring_t* ring = &IPC_SHARED->jobs;
+    uint32_t depth = job_ring_depth(&job_producer);
+    uint32_t done = job_count - depth;
+    uint64_t energy;
+
+    if (0UL == done)
+    {
+        return;
+    }
+
+    ipc_shared_fetch(&ring->tail, JOB_RING_LINE_WORDS * sizeof(uint32_t));
+    ipc_shared_fetch(&IPC_SHARED->job_results[0], sizeof(IPC_SHARED->job_results));
+    energy = IPC_SHARED->job_results[(done - 1U) & (JOB_RING_LEN - 1U)];
+
+    log_token(LOG_TOKEN_CM55_OFFLOAD, done, (uint32_t)energy, depth, job_producer.max_depth,
+              job_producer.doorbells, ring->wakes, ring->max_batch);
+}
+
+/*******************************************************************************
+* Function Name: cm55_offload_reset
+********************************************************************************
+* Summary:
+* Stops queuing jobs and drops the queued ones by clearing the job ring. Only
+* called while the CM55 is held in reset, the ring has no consumer then.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cm55_offload_reset(void)
+{
+    event_sched_timer_stop(offload_sched, &job_timer);
+    event_sched_timer_stop(offload_sched, &flush_timer);
+
+    job_ring_init(&IPC_SHARED->jobs, ipc_shared_publish);
+    job_ring_producer_init(&job_producer, &IPC_SHARED->jobs, CM55_OFFLOAD_BATCH,
+                           ipc_shared_publish, ipc_shared_fetch);
+    job_count = 0UL;
+}
+
+#endif /* defined(CM55_OFFLOAD_DEMO) */
+
+/* [] END OF FILE */
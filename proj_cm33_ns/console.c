@@ -0,0 +1,405 @@
+/*******************************************************************************
+ * File Name:   console.c
+ *
+ * Description: This file contains the command console used by host scripts
+ *              on the debug UART. It assembles the received characters into
+ *              command lines, runs the command from a table and answers with
+ *              a CRC protected binary frame.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <string.h>
+
+#include "console.h"
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: console_init
+********************************************************************************
+* Summary:
+* Initializes the console.
+*
+* Parameters:
+*  con - console state
+*  cmds - command table, must stay valid
+*  num_cmds - number of commands
+*  write - writes bytes to the UART
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void console_init(console_t* con, const console_cmd_t* cmds, uint32_t num_cmds,
+                  void (*write)(const uint8_t* data, uint32_t len))
+{
+    con->cmds = cmds;
+    con->num_cmds = num_cmds;
+    con->write = write;
+    con->line_len = 0UL;
+    con->overflow = false;
+    con->seq = 0U;
+    con->lines = 0UL;
+    con->errors = 0UL;
+}
+
+/*******************************************************************************
+* Function Name: console_crc16
+********************************************************************************
+* Summary:
+* Updates a CRC-16/CCITT (polynomial 0x1021) with a block of bytes.
+*
+* Parameters:
+*  data - bytes
+*  len - number of bytes
+*  crc - CRC so far, 0xFFFF for the first block
+*
+* Return:
+*  uint16_t - updated CRC
+*
+*******************************************************************************/
+uint16_t console_crc16(const uint8_t* data, uint32_t len, uint16_t crc)
+{
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8U);
+
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            crc = (0U != (crc & 0x8000U)) ? (uint16_t)((crc << 1U) ^ 0x1021U) : (uint16_t)(crc << 1U);
+        }
+    }
+
+    return crc;
+}
+
+/*******************************************************************************
+* Function Name: console_put_u32
+********************************************************************************
+* Summary:
+* Appends a little-endian 32-bit value to a response.
+*
+* Parameters:
+*  buf - response data
+*  pos - write position, advanced on success
+*  cap - size of buf
+*  value - value to append
+*
+* Return:
+*  bool - false if the value does not fit
+*
+*******************************************************************************/
+bool console_put_u32(uint8_t* buf, uint32_t* pos, uint32_t cap, uint32_t value)
+{
+    if ((cap < 4UL) || (*pos > (cap - 4UL)))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        buf[(*pos)++] = (uint8_t)(value >> (8U * i));
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: frame_header
+********************************************************************************
+* Summary:
+* Fills a frame header.
+*
+* Parameters:
+*  header - CONSOLE_HEADER_LEN bytes
+*  type - frame type
+*  seq - sequence number
+*  len - payload length
+*
+* Return:
+*  uint16_t - CRC of the header, to be continued over the payload
+*
+*******************************************************************************/
+static uint16_t frame_header(uint8_t* header, uint8_t type, uint8_t seq, uint32_t len)
+{
+    header[0] = CONSOLE_FRAME_SYNC;
+    header[1] = type;
+    header[2] = seq;
+    header[3] = (uint8_t)len;
+    header[4] = (uint8_t)(len >> 8U);
+
+    return console_crc16(&header[1], CONSOLE_HEADER_LEN - 1U, 0xFFFFU);
+}
+
+/*******************************************************************************
+* Function Name: console_frame
+********************************************************************************
+* Summary:
+* Completes a frame built in place, for senders that write a frame in one
+* piece. The payload must already be at frame[CONSOLE_HEADER_LEN], the header
+* and the trailer are added around it.
+*
+* Parameters:
+*  frame - CONSOLE_HEADER_LEN + len + CONSOLE_TRAILER_LEN bytes
+*  type - frame type
+*  seq - sequence number
+*  len - payload length
+*
+* Return:
+*  uint32_t - frame length
+*
+*******************************************************************************/
+uint32_t console_frame(uint8_t* frame, uint8_t type, uint8_t seq, uint32_t len)
+{
+    uint16_t crc = frame_header(frame, type, seq, len);
+
+    crc = console_crc16(&frame[CONSOLE_HEADER_LEN], len, crc);
+    frame[CONSOLE_HEADER_LEN + len] = (uint8_t)crc;
+    frame[CONSOLE_HEADER_LEN + len + 1U] = (uint8_t)(crc >> 8U);
+
+    return CONSOLE_HEADER_LEN + len + CONSOLE_TRAILER_LEN;
+}
+
+/*******************************************************************************
+* Function Name: console_send
+********************************************************************************
+* Summary:
+* Sends a frame.
+*
+* Parameters:
+*  con - console state
+*  type - frame type
+*  payload - frame payload
+*  len - payload length, at most CONSOLE_PAYLOAD_MAX
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void console_send(console_t* con, uint8_t type, const uint8_t* payload, uint32_t len)
+{
+    uint8_t header[CONSOLE_HEADER_LEN];
+    uint8_t trailer[CONSOLE_TRAILER_LEN];
+    uint16_t crc;
+
+    if (len > CONSOLE_PAYLOAD_MAX)
+    {
+        return;
+    }
+
+    crc = frame_header(header, type, con->seq++, len);
+    crc = console_crc16(payload, len, crc);
+    trailer[0] = (uint8_t)crc;
+    trailer[1] = (uint8_t)(crc >> 8U);
+
+    con->write(header, CONSOLE_HEADER_LEN);
+    if (0UL != len)
+    {
+        con->write(payload, len);
+    }
+    con->write(trailer, sizeof(trailer));
+}
+
+/*******************************************************************************
+* Function Name: run_help
+********************************************************************************
+* Summary:
+* Built-in help command, returns the command names separated by NUL
+* characters.
+*
+* Parameters:
+*  con - console state
+*  rsp - response data
+*  len - size of rsp, returns the bytes written
+*
+* Return:
+*  console_status_t - CONSOLE_STATUS_OVERFLOW if the names do not fit
+*
+*******************************************************************************/
+static console_status_t run_help(const console_t* con, uint8_t* rsp, uint32_t* len)
+{
+    uint32_t pos = 0UL;
+
+    for (uint32_t i = 0U; i < con->num_cmds; i++)
+    {
+        size_t name_len = strlen(con->cmds[i].name) + 1U;
+
+        if ((pos + name_len) > *len)
+        {
+            *len = pos;
+            return CONSOLE_STATUS_OVERFLOW;
+        }
+
+        memcpy(&rsp[pos], con->cmds[i].name, name_len);
+        pos += (uint32_t)name_len;
+    }
+
+    *len = pos;
+
+    return CONSOLE_STATUS_OK;
+}
+
+/*******************************************************************************
+* Function Name: run_line
+********************************************************************************
+* Summary:
+* Splits the received line into words, runs the command and sends the
+* response. Empty lines are ignored, so a script can send one to wake the
+* device up.
+*
+* Parameters:
+*  con - console state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void run_line(console_t* con)
+{
+    char* argv[CONSOLE_MAX_ARGS];
+    uint32_t argc = 0UL;
+    uint32_t len = CONSOLE_PAYLOAD_MAX - 1U;
+    console_status_t status = CONSOLE_STATUS_UNKNOWN;
+    char* p = con->line;
+
+    con->line[con->line_len] = '\0';
+
+    while ('\0' != *p)
+    {
+        while (' ' == *p)
+        {
+            *p++ = '\0';
+        }
+
+        if ('\0' != *p)
+        {
+            if (argc == CONSOLE_MAX_ARGS)
+            {
+                status = CONSOLE_STATUS_BAD_ARGS;
+                break;
+            }
+
+            argv[argc++] = p;
+
+            while (('\0' != *p) && (' ' != *p))
+            {
+                p++;
+            }
+        }
+    }
+
+    if (con->overflow)
+    {
+        status = CONSOLE_STATUS_OVERFLOW;
+        len = 0UL;
+    }
+    else if (0UL == argc)
+    {
+        return;
+    }
+    else if (CONSOLE_STATUS_BAD_ARGS != status)
+    {
+        if (0 == strcmp(argv[0], "help"))
+        {
+            status = run_help(con, &con->rsp[1], &len);
+        }
+
+        for (uint32_t i = 0U; (CONSOLE_STATUS_UNKNOWN == status) && (i < con->num_cmds); i++)
+        {
+            if (0 == strcmp(argv[0], con->cmds[i].name))
+            {
+                status = con->cmds[i].fn(argc, argv, &con->rsp[1], &len);
+            }
+        }
+    }
+
+    if ((CONSOLE_STATUS_OK != status) && (CONSOLE_STATUS_OVERFLOW != status))
+    {
+        len = 0UL;
+    }
+
+    con->lines++;
+    if (CONSOLE_STATUS_OK != status)
+    {
+        con->errors++;
+    }
+
+    con->rsp[0] = (uint8_t)status;
+    console_send(con, CONSOLE_FRAME_RESPONSE, con->rsp, len + 1UL);
+}
+
+/*******************************************************************************
+* Function Name: console_input
+********************************************************************************
+* Summary:
+* Feeds received characters to the console. Each line ending with CR or LF
+* is run as a command.
+*
+* Parameters:
+*  con - console state
+*  data - received characters
+*  len - number of characters
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void console_input(console_t* con, const uint8_t* data, uint32_t len)
+{
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        char c = (char)data[i];
+
+        if (('\r' == c) || ('\n' == c))
+        {
+            run_line(con);
+            con->line_len = 0UL;
+            con->overflow = false;
+        }
+        else if (con->line_len < (CONSOLE_LINE_MAX - 1U))
+        {
+            con->line[con->line_len++] = c;
+        }
+        else
+        {
+            con->overflow = true;
+        }
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * File Name:   console.h
+ *
+ * Description: This file is the public interface of console.c, the command
+ *              console used by host scripts on the debug UART.
+ *
+ *              Commands are text lines. Every line is answered with one
+ *              binary frame, which host scripts can find among the text
+ *              output because the sync byte is not ASCII:
+ *
+ *                  SYNC | TYPE | SEQ | LEN (2) | PAYLOAD (LEN) | CRC (2)
+ *
+ *              Multi-byte fields are little-endian. The CRC is CRC-16/CCITT
+ *              (polynomial 0x1021, initial value 0xFFFF) over TYPE to the end
+ *              of PAYLOAD. SEQ counts the frames sent. A response payload
+ *              starts with a console_status_t byte followed by the data of
+ *              the command.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _CONSOLE_H_
+#define _CONSOLE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The console only depends on the C library so it can be built on the host */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Longest command line, longer lines are rejected */
+#define CONSOLE_LINE_MAX            (64U)
+
+/* Maximum number of words in a command line, including the command */
+#define CONSOLE_MAX_ARGS            (4U)
+
+/* Largest frame payload */
+#define CONSOLE_PAYLOAD_MAX         (128U)
+
+/* First byte of every frame */
+#define CONSOLE_FRAME_SYNC          (0xA5U)
+
+/* Frame header: sync, type, sequence number and payload length */
+#define CONSOLE_HEADER_LEN          (5U)
+
+/* Frame trailer: CRC of the type to the end of the payload */
+#define CONSOLE_TRAILER_LEN         (2U)
+
+/* Frame types */
+#define CONSOLE_FRAME_RESPONSE      (0x01U)     /* Response to a command line */
+#define CONSOLE_FRAME_EVENT         (0x02U)     /* Unsolicited, the payload starts with an event ID */
+#define CONSOLE_FRAME_LOG           (0x03U)     /* Tokenized log message, see log_token.h */
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Command status, first byte of a response */
+typedef enum
+{
+    CONSOLE_STATUS_OK = 0U,
+    CONSOLE_STATUS_UNKNOWN,     /* No such command */
+    CONSOLE_STATUS_BAD_ARGS,    /* Wrong number or value of arguments */
+    CONSOLE_STATUS_BUSY,        /* The command cannot run now */
+    CONSOLE_STATUS_FAILED,      /* The command ran and failed */
+    CONSOLE_STATUS_OVERFLOW     /* The line or the response did not fit */
+} console_status_t;
+
+/* Command handler. Writes up to *len bytes of response data to rsp and sets
+ * *len to the bytes written. */
+typedef console_status_t (*console_cmd_fn_t)(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len);
+
+/* Command table entry */
+typedef struct
+{
+    const char*         name;
+    console_cmd_fn_t    fn;
+} console_cmd_t;
+
+/* Console state */
+typedef struct
+{
+    const console_cmd_t*    cmds;
+    uint32_t                num_cmds;
+    void                    (*write)(const uint8_t* data, uint32_t len);
+    char                    line[CONSOLE_LINE_MAX];
+    uint32_t                line_len;
+    bool                    overflow;   /* The line in progress is too long */
+    uint8_t                 seq;        /* Sequence number of the next frame */
+    uint8_t                 rsp[CONSOLE_PAYLOAD_MAX];
+    uint32_t                lines;      /* Command lines handled */
+    uint32_t                errors;     /* Command lines answered with an error */
+} console_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void console_init(console_t* con, const console_cmd_t* cmds, uint32_t num_cmds,
+                  void (*write)(const uint8_t* data, uint32_t len));
+void console_input(console_t* con, const uint8_t* data, uint32_t len);
+void console_send(console_t* con, uint8_t type, const uint8_t* payload, uint32_t len);
+uint32_t console_frame(uint8_t* frame, uint8_t type, uint8_t seq, uint32_t len);
+uint16_t console_crc16(const uint8_t* data, uint32_t len, uint16_t crc);
+bool console_put_u32(uint8_t* buf, uint32_t* pos, uint32_t cap, uint32_t value);
+
+#endif /* _CONSOLE_H_ */
+
+/* [] END OF FILE */
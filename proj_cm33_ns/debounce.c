@@ -0,0 +1,294 @@
+/*******************************************************************************
+ * File Name:   debounce.c
+ *
+ * Description: This file contains the input debounce service. Interrupts only
+ *              timestamp the edges of an input, a one-shot scheduler timer
+ *              confirms the new level once the input has been stable for the
+ *              settle time, and confirmed changes are queued for the
+ *              application. The scheduler timers run from the LPTimer, so
+ *              debouncing keeps working across Deep Sleep.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "debounce.h"
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: queue_push
+********************************************************************************
+* Summary:
+* Adds a confirmed event to the queue. The slot is written before the head is
+* advanced, so the application never sees a partial event.
+*
+* Parameters:
+*  db - service
+*  input - input that changed
+*
+* Return:
+*  bool - false if the queue is full
+*
+*******************************************************************************/
+static bool queue_push(debounce_t* db, const debounce_input_t* input)
+{
+    uint32_t head = db->head;
+    volatile debounce_event_t* slot;
+
+    if ((head - db->tail) >= DEBOUNCE_QUEUE_LEN)
+    {
+        return false;
+    }
+
+    slot = &db->queue[head & (DEBOUNCE_QUEUE_LEN - 1U)];
+    slot->id = input->id;
+    slot->active = input->active;
+    slot->tick = input->edge_tick;
+
+    db->head = head + 1U;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: settle_cb
+********************************************************************************
+* Summary:
+* Settle timer callback. The input has had no edge for the settle time, so its
+* level is final. A level that differs from the confirmed one is queued.
+*
+* Parameters:
+*  arg - input
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void settle_cb(void* arg)
+{
+    debounce_input_t* input = (debounce_input_t*)arg;
+    debounce_t* db = input->owner;
+    bool active = input->read();
+
+    if (active == input->active)
+    {
+        db->glitches++;
+    }
+    else
+    {
+        input->active = active;
+
+        if (queue_push(db, input))
+        {
+            event_sched_post(db->sched, db->notify_event);
+        }
+        else
+        {
+            db->dropped++;
+        }
+    }
+
+    input->bouncing = false;
+}
+
+/*******************************************************************************
+* Function Name: edge_event_cb
+********************************************************************************
+* Summary:
+* Scheduler event handler for the edges posted by debounce_edge(). (Re)starts
+* the settle timer of every input that had an edge, so it expires one settle
+* time after the last edge.
+*
+* Parameters:
+*  arg - service
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void edge_event_cb(void* arg)
+{
+    debounce_t* db = (debounce_t*)arg;
+
+    for (uint32_t i = 0U; i < db->num_inputs; i++)
+    {
+        debounce_input_t* input = db->inputs[i];
+
+        /* An edge after the flag is cleared posts the event again */
+        if (input->edge)
+        {
+            input->edge = false;
+            event_sched_timer_start(db->sched, &input->timer, input->settle_ticks, 0UL, settle_cb, input);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: debounce_init
+********************************************************************************
+* Summary:
+* Initializes the service and registers its edge event with the scheduler.
+*
+* Parameters:
+*  db - service
+*  sched - scheduler running the service
+*  edge_event - scheduler event used for the edges
+*  notify_event - scheduler event posted when confirmed events were queued
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void debounce_init(debounce_t* db, event_sched_t* sched, uint32_t edge_event, uint32_t notify_event)
+{
+    db->sched = sched;
+    db->edge_event = edge_event;
+    db->notify_event = notify_event;
+    db->num_inputs = 0U;
+    db->head = 0UL;
+    db->tail = 0UL;
+    db->dropped = 0UL;
+    db->glitches = 0UL;
+
+    event_sched_on(sched, edge_event, edge_event_cb, db);
+}
+
+/*******************************************************************************
+* Function Name: debounce_add
+********************************************************************************
+* Summary:
+* Adds an input to the service. The current level of the input is taken as
+* confirmed.
+*
+* Parameters:
+*  db - service
+*  input - input, must stay valid while the service runs
+*  id - identifier reported in the events of the input
+*  read - returns true while the input is active
+*  settle_ticks - time the input must be stable, in scheduler ticks
+*
+* Return:
+*  bool - false if the service has no room for the input
+*
+*******************************************************************************/
+bool debounce_add(debounce_t* db, debounce_input_t* input, uint32_t id, bool (*read)(void),
+                  uint32_t settle_ticks)
+{
+    if (db->num_inputs >= DEBOUNCE_MAX_INPUTS)
+    {
+        return false;
+    }
+
+    input->id = id;
+    input->read = read;
+    input->settle_ticks = settle_ticks;
+    input->active = read();
+    input->edge = false;
+    input->bouncing = false;
+    input->edge_tick = 0UL;
+    input->timer.active = false;
+    input->owner = db;
+
+    db->inputs[db->num_inputs++] = input;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: debounce_edge
+********************************************************************************
+* Summary:
+* Reports an edge of an input. Called from the input interrupt, it only
+* records the time of the first edge and posts the edge event.
+*
+* Parameters:
+*  input - input that had an edge
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void debounce_edge(debounce_input_t* input)
+{
+    debounce_t* db = input->owner;
+
+    if (!input->bouncing)
+    {
+        input->edge_tick = db->sched->port->now();
+        input->bouncing = true;
+    }
+
+    input->edge = true;
+    event_sched_post(db->sched, db->edge_event);
+}
+
+/*******************************************************************************
+* Function Name: debounce_pop
+********************************************************************************
+* Summary:
+* Takes the oldest confirmed event from the queue. Called by the application,
+* usually from the handler of the notify event.
+*
+* Parameters:
+*  db - service
+*  event - returns the event
+*
+* Return:
+*  bool - false if the queue is empty
+*
+*******************************************************************************/
+bool debounce_pop(debounce_t* db, debounce_event_t* event)
+{
+    uint32_t tail = db->tail;
+    volatile const debounce_event_t* slot;
+
+    if (tail == db->head)
+    {
+        return false;
+    }
+
+    slot = &db->queue[tail & (DEBOUNCE_QUEUE_LEN - 1U)];
+    event->id = slot->id;
+    event->active = slot->active;
+    event->tick = slot->tick;
+
+    db->tail = tail + 1U;
+
+    return true;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * File Name:   debounce.h
+ *
+ * Description: This file is the public interface of debounce.c, the input
+ *              debounce service built on the event scheduler.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _DEBOUNCE_H_
+#define _DEBOUNCE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The service only depends on the C library and the event scheduler so it can
+ * be built on the host */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "event_sched.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of inputs a service can debounce */
+#define DEBOUNCE_MAX_INPUTS     (4U)
+
+/* Number of confirmed events the queue holds, must be a power of two */
+#define DEBOUNCE_QUEUE_LEN      (8U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Confirmed input change */
+typedef struct
+{
+    uint32_t    id;         /* Input identifier */
+    bool        active;     /* New level of the input */
+    uint32_t    tick;       /* Scheduler tick of the first edge of the change */
+} debounce_event_t;
+
+/* Debounced input */
+typedef struct debounce_input
+{
+    uint32_t                id;
+    bool                    (*read)(void);  /* Returns true while the input is active */
+    uint32_t                settle_ticks;   /* Time the input must be stable */
+    bool                    active;         /* Last confirmed level */
+    volatile bool           edge;           /* Set by debounce_edge() */
+    volatile bool           bouncing;       /* Set from the first edge to the confirmation */
+    volatile uint32_t       edge_tick;      /* Tick of the first edge */
+    event_sched_timer_t     timer;          /* Settle timer */
+    struct debounce*        owner;          /* Set by the service */
+} debounce_input_t;
+
+/* Debounce service. The queue is written by the scheduler timer callbacks and
+ * read by the application, each index has a single writer so no lock is
+ * needed. */
+typedef struct debounce
+{
+    event_sched_t*          sched;
+    uint32_t                edge_event;     /* Posted by debounce_edge() */
+    uint32_t                notify_event;   /* Posted when events were queued */
+    debounce_input_t*       inputs[DEBOUNCE_MAX_INPUTS];
+    uint32_t                num_inputs;
+    volatile debounce_event_t queue[DEBOUNCE_QUEUE_LEN];
+    volatile uint32_t       head;           /* Written by the service */
+    volatile uint32_t       tail;           /* Written by the application */
+    uint32_t                dropped;        /* Events lost on a full queue */
+    uint32_t                glitches;       /* Edges that settled back to the confirmed level */
+} debounce_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void debounce_init(debounce_t* db, event_sched_t* sched, uint32_t edge_event, uint32_t notify_event);
+bool debounce_add(debounce_t* db, debounce_input_t* input, uint32_t id, bool (*read)(void),
+                  uint32_t settle_ticks);
+void debounce_edge(debounce_input_t* input);
+bool debounce_pop(debounce_t* db, debounce_event_t* event);
+
+#endif /* _DEBOUNCE_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * File Name:   dvfs_governor.c
+ *
+ * Description: This file contains the load-driven power mode governor. The
+ *              application reports the busy and idle time of each window, the
+ *              selected policy picks a performance level for the load, and the
+ *              governor rate limits the changes. Applying the level is left to
+ *              the application.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "dvfs_governor.h"
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: level_down
+********************************************************************************
+* Summary:
+* Returns the level below the current one once the load stayed low long
+* enough, the current level otherwise.
+*
+* Parameters:
+*  gov - governor
+*
+* Return:
+*  dvfs_level_t - level
+*
+*******************************************************************************/
+static dvfs_level_t level_down(const dvfs_governor_t* gov)
+{
+    if ((gov->low_windows >= gov->cfg.down_windows) && (DVFS_LEVEL_ULP != gov->level))
+    {
+        return (dvfs_level_t)(gov->level - 1U);
+    }
+
+    return gov->level;
+}
+
+/*******************************************************************************
+* Function Name: ondemand_decide
+********************************************************************************
+* Summary:
+* Ondemand policy.
+*
+* Parameters:
+*  gov - governor
+*  load_pct - load of the last window
+*
+* Return:
+*  dvfs_level_t - wanted level
+*
+*******************************************************************************/
+static dvfs_level_t ondemand_decide(const dvfs_governor_t* gov, uint32_t load_pct)
+{
+    return (load_pct >= gov->cfg.up_pct) ? DVFS_LEVEL_HP : level_down(gov);
+}
+
+/*******************************************************************************
+* Function Name: conservative_decide
+********************************************************************************
+* Summary:
+* Conservative policy.
+*
+* Parameters:
+*  gov - governor
+*  load_pct - load of the last window
+*
+* Return:
+*  dvfs_level_t - wanted level
+*
+*******************************************************************************/
+static dvfs_level_t conservative_decide(const dvfs_governor_t* gov, uint32_t load_pct)
+{
+    if ((load_pct >= gov->cfg.up_pct) && (DVFS_LEVEL_HP != gov->level))
+    {
+        return (dvfs_level_t)(gov->level + 1U);
+    }
+
+    return level_down(gov);
+}
+
+/*******************************************************************************
+* Function Name: race_to_idle_decide
+********************************************************************************
+* Summary:
+* Race-to-idle policy. Any load at or above down_pct is run in HP.
+*
+* Parameters:
+*  gov - governor
+*  load_pct - load of the last window
+*
+* Return:
+*  dvfs_level_t - wanted level
+*
+*******************************************************************************/
+static dvfs_level_t race_to_idle_decide(const dvfs_governor_t* gov, uint32_t load_pct)
+{
+    if (load_pct >= gov->cfg.down_pct)
+    {
+        return DVFS_LEVEL_HP;
+    }
+
+    return (gov->low_windows >= gov->cfg.down_windows) ? DVFS_LEVEL_ULP : gov->level;
+}
+
+const dvfs_policy_t dvfs_policy_ondemand = { "ondemand", DVFS_POLICY_ONDEMAND, ondemand_decide };
+const dvfs_policy_t dvfs_policy_conservative = { "conservative", DVFS_POLICY_CONSERVATIVE, conservative_decide };
+const dvfs_policy_t dvfs_policy_race_to_idle = { "race-to-idle", DVFS_POLICY_RACE_TO_IDLE, race_to_idle_decide };
+
+/*******************************************************************************
+* Function Name: dvfs_governor_init
+********************************************************************************
+* Summary:
+* Initializes the governor.
+*
+* Parameters:
+*  gov - governor
+*  policy - policy
+*  cfg - tuning, copied
+*  level - current level
+*  now_ms - current time in milliseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void dvfs_governor_init(dvfs_governor_t* gov, const dvfs_policy_t* policy,
+                        const dvfs_governor_cfg_t* cfg, dvfs_level_t level, uint32_t now_ms)
+{
+    gov->policy = policy;
+    gov->cfg = *cfg;
+    gov->level = level;
+    gov->load_pct = 0UL;
+    gov->low_windows = 0UL;
+    gov->last_change_ms = now_ms;
+    gov->changes = 0UL;
+}
+
+/*******************************************************************************
+* Function Name: dvfs_governor_set_policy
+********************************************************************************
+* Summary:
+* Switches to another policy. The current level is kept.
+*
+* Parameters:
+*  gov - governor
+*  policy - policy
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void dvfs_governor_set_policy(dvfs_governor_t* gov, const dvfs_policy_t* policy)
+{
+    gov->policy = policy;
+    gov->low_windows = 0UL;
+}
+
+/*******************************************************************************
+* Function Name: dvfs_governor_sample
+********************************************************************************
+* Summary:
+* Feeds the busy and idle time of a window, in any common unit, and returns
+* the level to run at. A change is suppressed until min_interval_ms passed
+* since the previous one. The caller applies the returned level.
+*
+* Parameters:
+*  gov - governor
+*  busy - busy time of the window
+*  idle - idle time of the window
+*  now_ms - current time in milliseconds
+*
+* Return:
+*  dvfs_level_t - level to run at
+*
+*******************************************************************************/
+dvfs_level_t dvfs_governor_sample(dvfs_governor_t* gov, uint32_t busy, uint32_t idle, uint32_t now_ms)
+{
+    uint64_t total = (uint64_t)busy + idle;
+    dvfs_level_t level;
+
+    gov->load_pct = (0ULL == total) ? 0UL : (uint32_t)(((uint64_t)busy * 100ULL) / total);
+    gov->low_windows = (gov->load_pct < gov->cfg.down_pct) ? (gov->low_windows + 1UL) : 0UL;
+
+    level = gov->policy->decide(gov, gov->load_pct);
+
+    if ((level != gov->level) && ((now_ms - gov->last_change_ms) >= gov->cfg.min_interval_ms))
+    {
+        gov->level = level;
+        gov->last_change_ms = now_ms;
+        gov->low_windows = 0UL;
+        gov->changes++;
+    }
+
+    return gov->level;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * File Name:   dvfs_governor.h
+ *
+ * Description: This file is the public interface of dvfs_governor.c, the
+ *              load-driven power mode governor.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _DVFS_GOVERNOR_H_
+#define _DVFS_GOVERNOR_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The governor only depends on the C library so it can be tested on the host
+ * with synthetic load traces */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Performance levels, ordered from the lowest to the highest */
+typedef enum
+{
+    DVFS_LEVEL_ULP = 0U,            /* Ultra Low Power mode */
+    DVFS_LEVEL_LP,                  /* Low Power mode */
+    DVFS_LEVEL_HP,                  /* High Performance mode */
+    DVFS_LEVEL_MAX
+} dvfs_level_t;
+
+/* Governor tuning */
+typedef struct
+{
+    uint32_t    up_pct;             /* Load at or above which performance is raised */
+    uint32_t    down_pct;           /* Load below which performance is lowered, below up_pct
+                                     * so that loads in between keep the level (hysteresis) */
+    uint32_t    down_windows;       /* Consecutive windows below down_pct before lowering */
+    uint32_t    min_interval_ms;    /* Minimum time between two level changes (rate limit) */
+} dvfs_governor_cfg_t;
+
+typedef struct dvfs_governor dvfs_governor_t;
+
+/* Policy identifiers, logged instead of the policy names */
+typedef enum
+{
+    DVFS_POLICY_ONDEMAND = 0U,
+    DVFS_POLICY_CONSERVATIVE,
+    DVFS_POLICY_RACE_TO_IDLE,
+    DVFS_POLICY_MAX
+} dvfs_policy_id_t;
+
+/* Policy, returns the level wanted for the load of the last window */
+typedef struct
+{
+    const char*         name;
+    dvfs_policy_id_t    id;
+    dvfs_level_t (*decide)(const dvfs_governor_t* gov, uint32_t load_pct);
+} dvfs_policy_t;
+
+/* Governor state */
+struct dvfs_governor
+{
+    const dvfs_policy_t*    policy;
+    dvfs_governor_cfg_t     cfg;
+    dvfs_level_t            level;          /* Current level */
+    uint32_t                load_pct;       /* Load of the last window */
+    uint32_t                low_windows;    /* Consecutive windows below down_pct */
+    uint32_t                last_change_ms; /* Time of the last level change */
+    uint32_t                changes;        /* Number of level changes */
+};
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Jumps to HP under load, steps down one level once the load stays low */
+extern const dvfs_policy_t dvfs_policy_ondemand;
+
+/* Steps one level up or down at a time */
+extern const dvfs_policy_t dvfs_policy_conservative;
+
+/* Runs any load in HP to finish it early, drops to ULP once the load stays low */
+extern const dvfs_policy_t dvfs_policy_race_to_idle;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void dvfs_governor_init(dvfs_governor_t* gov, const dvfs_policy_t* policy,
+                        const dvfs_governor_cfg_t* cfg, dvfs_level_t level, uint32_t now_ms);
+void dvfs_governor_set_policy(dvfs_governor_t* gov, const dvfs_policy_t* policy);
+dvfs_level_t dvfs_governor_sample(dvfs_governor_t* gov, uint32_t busy, uint32_t idle, uint32_t now_ms);
+
+#endif /* _DVFS_GOVERNOR_H_ */
+
+/* [] END OF FILE */
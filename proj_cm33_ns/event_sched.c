@@ -0,0 +1,417 @@
+/*******************************************************************************
+ * File Name:   event_sched.c
+ *
+ * Description: This file contains the tickless event-driven scheduler. Work is
+ *              triggered by events posted from interrupts and by software
+ *              timers sharing one hardware timer. Between them, the scheduler
+ *              arms the hardware timer for the next deadline and lets the port
+ *              put the CPU to sleep, so nothing runs periodically while idle.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "event_sched.h"
+
+/* The pending events are bits of a 32-bit word */
+_Static_assert(EVENT_SCHED_MAX_EVENTS <= 32U, "EVENT_SCHED_MAX_EVENTS does not fit the pending word");
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: is_due
+********************************************************************************
+* Summary:
+* Checks whether a deadline has been reached, across counter wrap-around.
+*
+* Parameters:
+*  deadline - deadline tick
+*  now - current tick
+*
+* Return:
+*  bool - true if the deadline has been reached
+*
+*******************************************************************************/
+static bool is_due(uint32_t deadline, uint32_t now)
+{
+    return ((int32_t)(now - deadline) >= 0);
+}
+
+/*******************************************************************************
+* Function Name: timer_unlink
+********************************************************************************
+* Summary:
+* Removes a timer from the active list. Must be called locked.
+*
+* Parameters:
+*  sched - scheduler
+*  timer - timer
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void timer_unlink(event_sched_t* sched, event_sched_timer_t* timer)
+{
+    event_sched_timer_t** link = &sched->timers;
+
+    while ((NULL != *link) && (timer != *link))
+    {
+        link = &(*link)->next;
+    }
+
+    if (NULL != *link)
+    {
+        *link = timer->next;
+    }
+
+    timer->active = false;
+}
+
+/*******************************************************************************
+* Function Name: timer_link
+********************************************************************************
+* Summary:
+* Inserts a timer into the active list by deadline. Timers with the same
+* deadline expire in insertion order. Must be called locked.
+*
+* Parameters:
+*  sched - scheduler
+*  timer - timer
+*  now - current tick
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void timer_link(event_sched_t* sched, event_sched_timer_t* timer, uint32_t now)
+{
+    event_sched_timer_t** link = &sched->timers;
+
+    while ((NULL != *link) && ((*link)->deadline - now) <= (timer->deadline - now))
+    {
+        link = &(*link)->next;
+    }
+
+    timer->next = *link;
+    timer->active = true;
+    *link = timer;
+}
+
+/*******************************************************************************
+* Function Name: event_sched_init
+********************************************************************************
+* Summary:
+* Initializes the scheduler. The port is not accessed, so the hardware can be
+* set up later. Load accounting starts with the first event_sched_take_load().
+*
+* Parameters:
+*  sched - scheduler
+*  port - hardware interface
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_sched_init(event_sched_t* sched, const event_sched_port_t* port)
+{
+    sched->port = port;
+    sched->timers = NULL;
+    sched->pending = 0UL;
+
+    for (uint32_t i = 0U; i < EVENT_SCHED_MAX_EVENTS; i++)
+    {
+        sched->handlers[i] = NULL;
+        sched->args[i] = NULL;
+    }
+
+    sched->mark = 0UL;
+    sched->busy_ticks = 0UL;
+    sched->idle_ticks = 0UL;
+}
+
+/*******************************************************************************
+* Function Name: event_sched_on
+********************************************************************************
+* Summary:
+* Sets the handler of an event. Event numbers out of range are ignored.
+*
+* Parameters:
+*  sched - scheduler
+*  event - event number, below EVENT_SCHED_MAX_EVENTS
+*  cb - handler, called from event_sched_run_once()
+*  arg - handler argument
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_sched_on(event_sched_t* sched, uint32_t event, event_sched_cb_t cb, void* arg)
+{
+    if (event < EVENT_SCHED_MAX_EVENTS)
+    {
+        sched->args[event] = arg;
+        sched->handlers[event] = cb;
+    }
+}
+
+/*******************************************************************************
+* Function Name: event_sched_post
+********************************************************************************
+* Summary:
+* Posts an event. Can be called from interrupts. An event posted again before
+* its handler ran is handled once. Event numbers out of range are ignored.
+*
+* Parameters:
+*  sched - scheduler
+*  event - event number, below EVENT_SCHED_MAX_EVENTS
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_sched_post(event_sched_t* sched, uint32_t event)
+{
+    uint32_t state;
+
+    if (event >= EVENT_SCHED_MAX_EVENTS)
+    {
+        return;
+    }
+
+    state = sched->port->lock();
+    sched->pending |= (1UL << event);
+    sched->port->unlock(state);
+}
+
+/*******************************************************************************
+* Function Name: event_sched_timer_start
+********************************************************************************
+* Summary:
+* Starts or restarts a software timer.
+*
+* Parameters:
+*  sched - scheduler
+*  timer - timer
+*  delay - ticks to the first expiry
+*  period - ticks between the following expiries, 0 for a one-shot timer
+*  cb - expiry callback, called from event_sched_run_once()
+*  arg - callback argument
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_sched_timer_start(event_sched_t* sched, event_sched_timer_t* timer, uint32_t delay,
+                             uint32_t period, event_sched_cb_t cb, void* arg)
+{
+    uint32_t state = sched->port->lock();
+    uint32_t now = sched->port->now();
+
+    if (timer->active)
+    {
+        timer_unlink(sched, timer);
+    }
+
+    timer->cb = cb;
+    timer->arg = arg;
+    timer->period = period;
+    timer->deadline = now + delay;
+    timer_link(sched, timer, now);
+
+    sched->port->unlock(state);
+}
+
+/*******************************************************************************
+* Function Name: event_sched_timer_stop
+********************************************************************************
+* Summary:
+* Stops a software timer.
+*
+* Parameters:
+*  sched - scheduler
+*  timer - timer
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_sched_timer_stop(event_sched_t* sched, event_sched_timer_t* timer)
+{
+    uint32_t state = sched->port->lock();
+
+    if (timer->active)
+    {
+        timer_unlink(sched, timer);
+    }
+
+    sched->port->unlock(state);
+}
+
+/*******************************************************************************
+* Function Name: event_sched_run_once
+********************************************************************************
+* Summary:
+* Runs the handlers of the posted events and the callbacks of the expired
+* timers. If nothing is left to do, arms the hardware timer for the next
+* deadline and idles until an interrupt. Called from the application loop.
+*
+* Parameters:
+*  sched - scheduler
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_sched_run_once(event_sched_t* sched)
+{
+    const event_sched_port_t* port = sched->port;
+    uint32_t state;
+    uint32_t events;
+    uint32_t now;
+    uint32_t ticks = EVENT_SCHED_IDLE_FOREVER;
+    bool can_idle = true;
+
+    state = port->lock();
+    events = sched->pending;
+    sched->pending = 0UL;
+    port->unlock(state);
+
+    for (uint32_t i = 0U; i < EVENT_SCHED_MAX_EVENTS; i++)
+    {
+        if ((0UL != (events & (1UL << i))) && (NULL != sched->handlers[i]))
+        {
+            sched->handlers[i](sched->args[i]);
+        }
+    }
+
+    for (;;)
+    {
+        event_sched_timer_t* timer;
+
+        state = port->lock();
+        now = port->now();
+        timer = sched->timers;
+
+        if ((NULL == timer) || !is_due(timer->deadline, now))
+        {
+            port->unlock(state);
+            break;
+        }
+
+        timer_unlink(sched, timer);
+        if (0UL != timer->period)
+        {
+            /* Keep the period, unless expiries were missed */
+            timer->deadline += timer->period;
+            if (is_due(timer->deadline, now))
+            {
+                timer->deadline = now + timer->period;
+            }
+            timer_link(sched, timer, now);
+        }
+        port->unlock(state);
+
+        timer->cb(timer->arg);
+    }
+
+    state = port->lock();
+
+    if (0UL == sched->pending)
+    {
+        now = port->now();
+
+        if (NULL != sched->timers)
+        {
+            ticks = sched->timers->deadline - now;
+            can_idle = !is_due(sched->timers->deadline, now) && port->set_wakeup(sched->timers->deadline);
+        }
+
+        if (can_idle)
+        {
+            sched->busy_ticks += now - sched->mark;
+            sched->mark = now;
+
+            port->idle(ticks);
+
+            now = port->now();
+            sched->idle_ticks += now - sched->mark;
+            sched->mark = now;
+        }
+    }
+
+    port->unlock(state);
+}
+
+/*******************************************************************************
+* Function Name: event_sched_take_load
+********************************************************************************
+* Summary:
+* Returns the busy and idle ticks since the previous call and restarts the
+* load accounting.
+*
+* Parameters:
+*  sched - scheduler
+*  busy - returns the busy ticks, can be NULL
+*  idle - returns the idle ticks, can be NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_sched_take_load(event_sched_t* sched, uint32_t* busy, uint32_t* idle)
+{
+    uint32_t state = sched->port->lock();
+    uint32_t now = sched->port->now();
+
+    if (NULL != busy)
+    {
+        *busy = sched->busy_ticks + (now - sched->mark);
+    }
+
+    if (NULL != idle)
+    {
+        *idle = sched->idle_ticks;
+    }
+
+    sched->mark = now;
+    sched->busy_ticks = 0UL;
+    sched->idle_ticks = 0UL;
+
+    sched->port->unlock(state);
+}
+
+/* [] END OF FILE */
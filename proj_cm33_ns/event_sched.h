@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * File Name:   event_sched.h
+ *
+ * Description: This file is the public interface of event_sched.c, the
+ *              tickless event-driven scheduler of the non-secure application.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _EVENT_SCHED_H_
+#define _EVENT_SCHED_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The scheduler only depends on the C library, the hardware is reached through
+ * event_sched_port_t so that it can be built on the host */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of events that can be posted from interrupts */
+#define EVENT_SCHED_MAX_EVENTS      (8U)
+
+/* Idle time passed to event_sched_port_t.idle when no timer is running */
+#define EVENT_SCHED_IDLE_FOREVER    (UINT32_MAX)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+typedef void (*event_sched_cb_t)(void* arg);
+
+/* Hardware interface of the scheduler */
+typedef struct
+{
+    uint32_t    (*now)(void);                   /* Free-running tick counter that keeps counting in Deep Sleep */
+    bool        (*set_wakeup)(uint32_t tick);   /* Arms an interrupt at tick, false if it is too close to arm */
+    void        (*idle)(uint32_t ticks);        /* Sleeps for up to ticks, called with interrupts locked
+                                                 * and returns on any interrupt */
+    uint32_t    (*lock)(void);                  /* Disables interrupts, returns the previous state */
+    void        (*unlock)(uint32_t state);      /* Restores the interrupt state */
+} event_sched_port_t;
+
+/* Software timer */
+typedef struct event_sched_timer
+{
+    event_sched_cb_t            cb;
+    void*                       arg;
+    uint32_t                    deadline;   /* Tick of the next expiry */
+    uint32_t                    period;     /* Reload in ticks, 0 for a one-shot timer */
+    bool                        active;
+    struct event_sched_timer*   next;       /* Set by the scheduler */
+} event_sched_timer_t;
+
+/* Scheduler state */
+typedef struct
+{
+    const event_sched_port_t*   port;
+    event_sched_timer_t*        timers;     /* Active timers, by deadline */
+    volatile uint32_t           pending;    /* Posted events, bit per event */
+    event_sched_cb_t            handlers[EVENT_SCHED_MAX_EVENTS];
+    void*                       args[EVENT_SCHED_MAX_EVENTS];
+    uint32_t                    mark;       /* Tick of the last switch between busy and idle */
+    uint32_t                    busy_ticks; /* Busy ticks since the last event_sched_take_load() */
+    uint32_t                    idle_ticks; /* Idle ticks since the last event_sched_take_load() */
+} event_sched_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void event_sched_init(event_sched_t* sched, const event_sched_port_t* port);
+void event_sched_on(event_sched_t* sched, uint32_t event, event_sched_cb_t cb, void* arg);
+void event_sched_post(event_sched_t* sched, uint32_t event);
+void event_sched_timer_start(event_sched_t* sched, event_sched_timer_t* timer, uint32_t delay,
+                             uint32_t period, event_sched_cb_t cb, void* arg);
+void event_sched_timer_stop(event_sched_t* sched, event_sched_timer_t* timer);
+void event_sched_run_once(event_sched_t* sched);
+void event_sched_take_load(event_sched_t* sched, uint32_t* busy, uint32_t* idle);
+
+#endif /* _EVENT_SCHED_H_ */
+
+/* [] END OF FILE */
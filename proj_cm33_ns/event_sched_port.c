@@ -0,0 +1,281 @@
+/*******************************************************************************
+ * File Name:   event_sched_port.c
+ *
+ * Description: This file contains the hardware interface of the event
+ *              scheduler. The CM33 LPTimer provides the time base and the
+ *              wake-up interrupt, and the CPU idles in Sleep or, for longer
+ *              gaps, in Deep Sleep through the secure SysPm operation.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "mtb_hal.h"
+#include "retarget_io_init.h"
+#include "event_sched_port.h"
+#include "trace.h"
+
+#include "user_syspm_srf.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* LPTimer interrupt priority */
+#define EVENT_SCHED_PORT_IRQ_PRIORITY   (3U)
+
+/* LPTimer interrupt priority while a hook is installed, so that the hook is
+ * not delayed by other interrupts */
+#define EVENT_SCHED_PORT_HOOK_PRIORITY  (0U)
+
+/* Wait time for the LPTimer counters to be enabled */
+#define EVENT_SCHED_PORT_WAIT_USEC      (62U)
+
+/* A match closer than this cannot be armed reliably, the MCWDT needs a few
+ * CLK_LF cycles to take a new match value */
+#define EVENT_SCHED_PORT_MIN_LEAD       (3U)
+
+/* Shorter idle periods use CPU Sleep, the Deep Sleep entry and exit cost more
+ * than they save */
+#define EVENT_SCHED_PORT_DS_MIN_TICKS   (EVENT_SCHED_MS_TO_TICKS(2U))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static mtb_hal_lptimer_t event_sched_lptimer;
+
+/* Deep Sleep is only entered while nobody holds it off */
+static uint32_t event_sched_ds_holds = 0UL;
+
+/* Called first in the LPTimer interrupt handler, see event_sched_port_set_isr_hook() */
+static void (*volatile event_sched_isr_hook)(void) = NULL;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: port_isr
+********************************************************************************
+* Summary:
+*  LPTimer interrupt handler. The interrupt only wakes the CPU, the scheduler
+*  finds the expired timers itself.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void port_isr(void)
+{
+    void (*hook)(void) = event_sched_isr_hook;
+
+    if (NULL != hook)
+    {
+        hook();
+    }
+
+    TRACE_ISR_BEGIN();
+    mtb_hal_lptimer_process_interrupt(&event_sched_lptimer);
+    TRACE_ISR_END();
+}
+
+/*******************************************************************************
+* Function Name: port_now
+********************************************************************************
+* Summary:
+*  Returns the LPTimer counter.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - current tick
+*
+*******************************************************************************/
+static uint32_t port_now(void)
+{
+    return mtb_hal_lptimer_read(&event_sched_lptimer);
+}
+
+/*******************************************************************************
+* Function Name: port_set_wakeup
+********************************************************************************
+* Summary:
+*  Arms the LPTimer match interrupt.
+*
+* Parameters:
+*  tick - tick to wake up at
+*
+* Return:
+*  bool - false if the tick is too close to be armed
+*
+*******************************************************************************/
+static bool port_set_wakeup(uint32_t tick)
+{
+    if ((tick - port_now()) < EVENT_SCHED_PORT_MIN_LEAD)
+    {
+        return false;
+    }
+
+    return (CY_RSLT_SUCCESS == mtb_hal_lptimer_set_match(&event_sched_lptimer, tick));
+}
+
+/*******************************************************************************
+* Function Name: port_idle
+********************************************************************************
+* Summary:
+*  Idles until the next interrupt. Deep Sleep is only used for long enough
+*  gaps, once the debug UART has sent everything and while not held off.
+*
+* Parameters:
+*  ticks - ticks to the next timer expiry
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void port_idle(uint32_t ticks)
+{
+    if ((ticks >= EVENT_SCHED_PORT_DS_MIN_TICKS) && (0UL == event_sched_ds_holds) && retarget_io_tx_idle())
+    {
+        TRACE_BEGIN(TRACE_EV_DEEP_SLEEP, 0UL);
+        (void)Cy_USER_SysEnterDS();
+        TRACE_END(TRACE_EV_DEEP_SLEEP, 0UL);
+    }
+    else
+    {
+        TRACE_BEGIN(TRACE_EV_CPU_SLEEP, 0UL);
+        (void)Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        TRACE_END(TRACE_EV_CPU_SLEEP, 0UL);
+    }
+}
+
+const event_sched_port_t event_sched_lptimer_port =
+{
+    .now = port_now,
+    .set_wakeup = port_set_wakeup,
+    .idle = port_idle,
+    .lock = Cy_SysLib_EnterCriticalSection,
+    .unlock = Cy_SysLib_ExitCriticalSection
+};
+
+/*******************************************************************************
+* Function Name: event_sched_port_init
+********************************************************************************
+* Summary:
+*  Initializes the CM33 LPTimer and its interrupt for the scheduler.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_sched_port_init(void)
+{
+    cy_stc_sysint_t lptimer_int_config =
+    {
+        .intrSrc = CYBSP_CM33_LPTIMER_0_IRQ,
+        .intrPriority = EVENT_SCHED_PORT_IRQ_PRIORITY
+    };
+
+    if ((CY_MCWDT_SUCCESS != Cy_MCWDT_Init(CYBSP_CM33_LPTIMER_0_HW, &CYBSP_CM33_LPTIMER_0_config)) ||
+        (CY_RSLT_SUCCESS != mtb_hal_lptimer_setup(&event_sched_lptimer, &CYBSP_CM33_LPTIMER_0_hal_config)))
+    {
+        handle_app_error();
+    }
+    Cy_MCWDT_Enable(CYBSP_CM33_LPTIMER_0_HW, CY_MCWDT_CTR_Msk, EVENT_SCHED_PORT_WAIT_USEC);
+
+    Cy_SysInt_Init(&lptimer_int_config, port_isr);
+    NVIC_EnableIRQ(lptimer_int_config.intrSrc);
+    mtb_hal_lptimer_enable_event(&event_sched_lptimer, MTB_HAL_LPTIMER_COMPARE_MATCH, true);
+}
+
+/*******************************************************************************
+* Function Name: event_sched_port_set_isr_hook
+********************************************************************************
+* Summary:
+*  Installs a function called first in the LPTimer interrupt handler, or removes
+*  it. The interrupt runs at the highest priority while a hook is installed.
+*  Lets the latency benchmark timestamp the handler entry on the running
+*  LPTimer, without taking it over and resetting the scheduler time base.
+*
+* Parameters:
+*  hook - function to call, NULL to remove the hook
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_sched_port_set_isr_hook(void (*hook)(void))
+{
+    event_sched_isr_hook = hook;
+    NVIC_SetPriority(CYBSP_CM33_LPTIMER_0_IRQ,
+                     (NULL != hook) ? EVENT_SCHED_PORT_HOOK_PRIORITY : EVENT_SCHED_PORT_IRQ_PRIORITY);
+}
+
+/*******************************************************************************
+* Function Name: event_sched_port_hold_ds
+********************************************************************************
+* Summary:
+*  Holds Deep Sleep off or releases a hold. The scheduler idles in CPU Sleep
+*  while any hold is taken. Called from the scheduler loop, or from the
+*  tickless idle hook of the FreeRTOS port with interrupts disabled.
+*
+* Parameters:
+*  hold - true to take a hold, false to release one
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void event_sched_port_hold_ds(bool hold)
+{
+    if (hold)
+    {
+        event_sched_ds_holds++;
+    }
+    else if (0UL != event_sched_ds_holds)
+    {
+        event_sched_ds_holds--;
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,368 @@
+/*******************************************************************************
+ * File Name:   latency_bench.c
+ *
+ * Description: This file contains the interrupt and wake-up latency benchmark,
+ *              built when LATENCY_BENCHMARK is set in the Makefile. The CM33
+ *              LPTimer raises an interrupt on a known tick while the CPU is
+ *              active in HP, LP and ULP, or in Deep Sleep entered from each of
+ *              them. The handler and the thread timestamp their entry against
+ *              that tick and the results are printed as CSV histograms over the
+ *              debug UART.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "latency_bench.h"
+
+#if defined(LATENCY_BENCHMARK)
+
+#include <stdio.h>
+
+#include "cybsp.h"
+#include "retarget_io_init.h"
+#include "event_sched_port.h"
+#include "latency_stats.h"
+
+#include "user_syspm_srf.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Samples per power mode and metric */
+#define LATENCY_BENCH_SAMPLES           (64U)
+
+/* Distance of the interrupt tick from the time it is armed, in LPTimer ticks */
+#define LATENCY_BENCH_DELAY_TICKS       (8U)
+
+/* LPTimer ticks used to measure the CPU cycles per tick in each power mode */
+#define LATENCY_BENCH_CAL_TICKS         (32U)
+
+/* The LPTimer runs from CLK_LF, sourced from the WCO */
+#define LATENCY_BENCH_LF_HZ             (EVENT_SCHED_PORT_HZ)
+
+/* Size of one formatted result */
+#define LATENCY_BENCH_LINE_LEN          (256U)
+
+/* Metrics measured in each power mode */
+typedef enum
+{
+    LATENCY_METRIC_IRQ = 0U,        /* Interrupt while the CPU is active */
+    LATENCY_METRIC_DS_ISR,          /* Deep Sleep wake-up to handler entry */
+    LATENCY_METRIC_DS_THREAD,       /* Deep Sleep wake-up to thread resume */
+    LATENCY_METRIC_MAX
+} latency_metric_t;
+
+/* Power modes the benchmark runs in */
+typedef enum
+{
+    LATENCY_MODE_HP = 0U,
+    LATENCY_MODE_LP,
+    LATENCY_MODE_ULP,
+    LATENCY_MODE_MAX
+} latency_mode_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static const char* const latency_mode_names[LATENCY_MODE_MAX] = { "HP", "LP", "ULP" };
+static const char* const latency_metric_names[LATENCY_METRIC_MAX] = { "irq", "ds_isr", "ds_thread" };
+
+/* LPTimer tick the pending interrupt is raised on */
+static volatile uint32_t bench_match;
+static volatile bool bench_fired;
+static volatile uint32_t bench_isr_ns;
+
+/* CPU cycles per LPTimer tick in the current power mode */
+static uint32_t bench_cycles_per_tick;
+
+static latency_stats_t bench_stats[LATENCY_MODE_MAX][LATENCY_METRIC_MAX];
+static uint32_t bench_cycles[LATENCY_MODE_MAX];
+static uint32_t bench_dropped[LATENCY_MODE_MAX];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: ns_since_match
+********************************************************************************
+* Summary:
+*  Returns the time elapsed since the LPTimer tick of the pending interrupt. The
+*  LPTimer counter is read first, then the CPU cycles to the next tick edge are
+*  counted to resolve the time within the tick.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - nanoseconds since the interrupt tick
+*
+*******************************************************************************/
+static uint32_t ns_since_match(void)
+{
+    uint32_t ticks = event_sched_lptimer_port.now();
+    uint32_t start = DWT->CYCCNT;
+
+    while (event_sched_lptimer_port.now() == ticks)
+    {
+    }
+
+    return latency_stats_from_edge(ticks - bench_match, DWT->CYCCNT - start,
+                                   bench_cycles_per_tick, LATENCY_BENCH_LF_HZ);
+}
+
+/*******************************************************************************
+* Function Name: latency_bench_isr
+********************************************************************************
+* Summary:
+*  Hook called first in the LPTimer interrupt handler of the scheduler port.
+*  Timestamps the handler entry.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void latency_bench_isr(void)
+{
+    bench_isr_ns = ns_since_match();
+    bench_fired = true;
+}
+
+/*******************************************************************************
+* Function Name: calibrate
+********************************************************************************
+* Summary:
+*  Measures the CPU cycles per LPTimer tick in the current power mode, so that
+*  the results do not depend on the nominal clock frequency.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - CPU cycles per LPTimer tick
+*
+*******************************************************************************/
+static uint32_t calibrate(void)
+{
+    uint32_t ticks = event_sched_lptimer_port.now();
+    uint32_t start;
+
+    /* Start on a tick edge */
+    while (event_sched_lptimer_port.now() == ticks)
+    {
+    }
+
+    start = DWT->CYCCNT;
+    ticks = event_sched_lptimer_port.now();
+
+    while ((event_sched_lptimer_port.now() - ticks) < LATENCY_BENCH_CAL_TICKS)
+    {
+    }
+
+    return (DWT->CYCCNT - start) / LATENCY_BENCH_CAL_TICKS;
+}
+
+/*******************************************************************************
+* Function Name: arm
+********************************************************************************
+* Summary:
+*  Schedules the next LPTimer interrupt.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void arm(void)
+{
+    bench_fired = false;
+    bench_match = event_sched_lptimer_port.now() + LATENCY_BENCH_DELAY_TICKS;
+
+    (void)event_sched_lptimer_port.set_wakeup(bench_match);
+}
+
+/*******************************************************************************
+* Function Name: run_mode
+********************************************************************************
+* Summary:
+*  Collects the samples of all metrics in the current power mode. A Deep Sleep
+*  sample is dropped when another wake-up source ended the Deep Sleep before
+*  the LPTimer interrupt.
+*
+* Parameters:
+*  mode - current power mode
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void run_mode(latency_mode_t mode)
+{
+    latency_stats_t* stats = bench_stats[mode];
+
+    bench_cycles_per_tick = calibrate();
+    bench_cycles[mode] = bench_cycles_per_tick;
+
+    for (uint32_t i = 0U; i < LATENCY_BENCH_SAMPLES; i++)
+    {
+        arm();
+        while (!bench_fired)
+        {
+        }
+
+        latency_stats_add(&stats[LATENCY_METRIC_IRQ], bench_isr_ns);
+    }
+
+    for (uint32_t i = 0U; i < LATENCY_BENCH_SAMPLES; i++)
+    {
+        arm();
+
+        if ((CY_USER_SYSPM_SUCCESS == Cy_USER_SysEnterDS()) && bench_fired)
+        {
+            uint32_t thread_ns = ns_since_match();
+
+            latency_stats_add(&stats[LATENCY_METRIC_DS_ISR], bench_isr_ns);
+            latency_stats_add(&stats[LATENCY_METRIC_DS_THREAD], thread_ns);
+        }
+        else
+        {
+            bench_dropped[mode]++;
+            while (!bench_fired)
+            {
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: print_results
+********************************************************************************
+* Summary:
+*  Prints the results of all power modes as CSV lines, see
+*  latency_stats_format() for the LAT and HIST lines.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_results(void)
+{
+    static char line[LATENCY_BENCH_LINE_LEN];
+
+    printf("LATBENCH,BEGIN,%u,%u,%u\r\n", (unsigned int)LATENCY_BENCH_SAMPLES,
+           (unsigned int)LATENCY_BENCH_DELAY_TICKS, (unsigned int)LATENCY_STATS_BUCKETS);
+
+    for (uint32_t mode = 0U; mode < (uint32_t)LATENCY_MODE_MAX; mode++)
+    {
+        printf("CAL,%s,%u\r\n", latency_mode_names[mode], (unsigned int)bench_cycles[mode]);
+        printf("DROP,%s,%u\r\n", latency_mode_names[mode], (unsigned int)bench_dropped[mode]);
+
+        for (uint32_t metric = 0U; metric < (uint32_t)LATENCY_METRIC_MAX; metric++)
+        {
+            (void)latency_stats_format(&bench_stats[mode][metric], latency_mode_names[mode],
+                                       latency_metric_names[metric], line, sizeof(line));
+            printf("%s", line);
+        }
+    }
+
+    printf("LATBENCH,END\r\n");
+}
+
+/*******************************************************************************
+* Function Name: latency_bench_run
+********************************************************************************
+* Summary:
+*  Runs the benchmark in HP, LP and ULP, returns to HP and prints the results.
+*  Must be called in HP, after event_sched_port_init() and before the scheduler
+*  has timers running. The benchmark arms the LPTimer match of the scheduler
+*  port and leaves its counter running, and the user button must not be
+*  pressed.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void latency_bench_run(void)
+{
+    for (uint32_t mode = 0U; mode < (uint32_t)LATENCY_MODE_MAX; mode++)
+    {
+        for (uint32_t metric = 0U; metric < (uint32_t)LATENCY_METRIC_MAX; metric++)
+        {
+            latency_stats_reset(&bench_stats[mode][metric]);
+        }
+        bench_dropped[mode] = 0UL;
+    }
+
+    /* Enable the CPU cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    event_sched_port_set_isr_hook(latency_bench_isr);
+
+    printf(" Running latency benchmark, do not press USER BTN1\r\n");
+    retarget_io_flush();
+
+    run_mode(LATENCY_MODE_HP);
+
+    (void)Cy_USER_SysEnterLp();
+    run_mode(LATENCY_MODE_LP);
+
+    (void)Cy_USER_SysEnterUlp();
+    run_mode(LATENCY_MODE_ULP);
+
+    (void)Cy_USER_SysEnterLp();
+    (void)Cy_USER_SysEnterHp();
+
+    event_sched_port_set_isr_hook(NULL);
+
+    print_results();
+}
+
+#endif /* defined(LATENCY_BENCHMARK) */
+
+/* [] END OF FILE */
@@ -0,0 +1,280 @@
+/*******************************************************************************
+ * File Name:   latency_stats.c
+ *
+ * Description: This file contains the aggregation of latency samples into
+ *              logarithmic histograms and their machine-readable report.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+
+#include "latency_stats.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define NS_PER_SEC      (1000000000ULL)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: bucket_of
+********************************************************************************
+* Summary:
+* Returns the histogram bucket of a sample.
+*
+* Parameters:
+*  ns - sample in nanoseconds
+*
+* Return:
+*  uint32_t - bucket index
+*
+*******************************************************************************/
+static uint32_t bucket_of(uint32_t ns)
+{
+    uint32_t bucket = 0U;
+
+    while ((ns > 1UL) && (bucket < (LATENCY_STATS_BUCKETS - 1U)))
+    {
+        ns >>= 1U;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+/*******************************************************************************
+* Function Name: latency_stats_reset
+********************************************************************************
+* Summary:
+* Discards all samples.
+*
+* Parameters:
+*  stats - latency statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void latency_stats_reset(latency_stats_t* stats)
+{
+    stats->count = 0UL;
+    stats->min_ns = UINT32_MAX;
+    stats->max_ns = 0UL;
+    stats->sum_ns = 0ULL;
+
+    for (uint32_t i = 0U; i < LATENCY_STATS_BUCKETS; i++)
+    {
+        stats->hist[i] = 0UL;
+    }
+}
+
+/*******************************************************************************
+* Function Name: latency_stats_add
+********************************************************************************
+* Summary:
+* Adds a sample.
+*
+* Parameters:
+*  stats - latency statistics
+*  ns - sample in nanoseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void latency_stats_add(latency_stats_t* stats, uint32_t ns)
+{
+    stats->count++;
+    stats->sum_ns += ns;
+
+    if (ns < stats->min_ns)
+    {
+        stats->min_ns = ns;
+    }
+
+    if (ns > stats->max_ns)
+    {
+        stats->max_ns = ns;
+    }
+
+    stats->hist[bucket_of(ns)]++;
+}
+
+/*******************************************************************************
+* Function Name: latency_stats_mean
+********************************************************************************
+* Summary:
+* Returns the mean of the samples.
+*
+* Parameters:
+*  stats - latency statistics
+*
+* Return:
+*  uint32_t - mean in nanoseconds, 0 without samples
+*
+*******************************************************************************/
+uint32_t latency_stats_mean(const latency_stats_t* stats)
+{
+    return (0UL == stats->count) ? 0UL : (uint32_t)(stats->sum_ns / stats->count);
+}
+
+/*******************************************************************************
+* Function Name: latency_stats_percentile
+********************************************************************************
+* Summary:
+* Returns an upper bound of a percentile, the upper edge of the histogram
+* bucket that contains it, clamped to the largest sample.
+*
+* Parameters:
+*  stats - latency statistics
+*  pct - percentile, 0 to 100
+*
+* Return:
+*  uint32_t - percentile in nanoseconds, 0 without samples
+*
+*******************************************************************************/
+uint32_t latency_stats_percentile(const latency_stats_t* stats, uint32_t pct)
+{
+    uint64_t rank = (((uint64_t)stats->count * pct) + 99ULL) / 100ULL;
+    uint64_t seen = 0ULL;
+    uint32_t bucket = 0U;
+
+    if (0UL == stats->count)
+    {
+        return 0UL;
+    }
+
+    for (bucket = 0U; bucket < (LATENCY_STATS_BUCKETS - 1U); bucket++)
+    {
+        seen += stats->hist[bucket];
+        if ((seen >= rank) && (0ULL != seen))
+        {
+            break;
+        }
+    }
+
+    if ((bucket < (LATENCY_STATS_BUCKETS - 1U)) && (((2UL << bucket) - 1UL) < stats->max_ns))
+    {
+        return (2UL << bucket) - 1UL;
+    }
+
+    return stats->max_ns;
+}
+
+/*******************************************************************************
+* Function Name: latency_stats_from_edge
+********************************************************************************
+* Summary:
+* Converts a timestamp taken against a slow reference clock to nanoseconds
+* since the reference tick the event was raised on. The handler reads the tick
+* counter, then counts CPU cycles until the next tick edge, which resolves the
+* time within the tick to a few CPU cycles.
+*
+* Parameters:
+*  ticks_late - reference ticks read by the handler minus the event tick
+*  cycles_to_edge - CPU cycles from the read to the next tick edge
+*  cycles_per_tick - CPU cycles per reference tick
+*  tick_hz - reference clock frequency
+*
+* Return:
+*  uint32_t - latency in nanoseconds
+*
+*******************************************************************************/
+uint32_t latency_stats_from_edge(uint32_t ticks_late, uint32_t cycles_to_edge,
+                                 uint32_t cycles_per_tick, uint32_t tick_hz)
+{
+    uint64_t cycles = ((uint64_t)ticks_late + 1ULL) * cycles_per_tick;
+
+    cycles = (cycles > cycles_to_edge) ? (cycles - cycles_to_edge) : 0ULL;
+
+    return (uint32_t)((cycles * NS_PER_SEC) / ((uint64_t)cycles_per_tick * tick_hz));
+}
+
+/*******************************************************************************
+* Function Name: latency_stats_format
+********************************************************************************
+* Summary:
+* Formats the statistics as two CSV lines:
+*  LAT,<mode>,<metric>,<count>,<min>,<mean>,<p99>,<max>
+*  HIST,<mode>,<metric>,<bucket 0>,...,<bucket LATENCY_STATS_BUCKETS-1>
+* All times are in nanoseconds.
+*
+* Parameters:
+*  stats - latency statistics
+*  mode - power mode name
+*  metric - metric name
+*  buf - output buffer
+*  len - size of the output buffer
+*
+* Return:
+*  size_t - length of the output, truncated to the buffer
+*
+*******************************************************************************/
+size_t latency_stats_format(const latency_stats_t* stats, const char* mode, const char* metric,
+                            char* buf, size_t len)
+{
+    size_t pos = 0U;
+    int n;
+
+    n = snprintf(buf, len, "LAT,%s,%s,%lu,%lu,%lu,%lu,%lu\r\nHIST,%s,%s", mode, metric,
+                 (unsigned long)stats->count,
+                 (unsigned long)((0UL == stats->count) ? 0UL : stats->min_ns),
+                 (unsigned long)latency_stats_mean(stats),
+                 (unsigned long)latency_stats_percentile(stats, 99U),
+                 (unsigned long)stats->max_ns, mode, metric);
+
+    for (uint32_t i = 0U; (n >= 0) && (i <= LATENCY_STATS_BUCKETS); i++)
+    {
+        pos += (size_t)n;
+        if (pos >= len)
+        {
+            return (len > 0U) ? (len - 1U) : 0U;
+        }
+
+        n = (i < LATENCY_STATS_BUCKETS) ? snprintf(&buf[pos], len - pos, ",%lu", (unsigned long)stats->hist[i]) :
+                                          snprintf(&buf[pos], len - pos, "\r\n");
+    }
+
+    pos += (n > 0) ? (size_t)n : 0U;
+
+    return (pos >= len) ? (len - 1U) : pos;
+}
+
+/* [] END OF FILE */
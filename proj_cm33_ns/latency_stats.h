@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * File Name:   latency_stats.h
+ *
+ * Description: This file is the public interface of latency_stats.c, the
+ *              aggregation of latency samples into histograms used by the
+ *              latency benchmark.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _LATENCY_STATS_H_
+#define _LATENCY_STATS_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The aggregation only depends on the C library so it can be built on the host */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of histogram buckets. Bucket 0 holds samples below 2 ns and bucket k
+ * holds samples in [2^k, 2^(k+1)) ns, the last bucket also holds larger ones. */
+#define LATENCY_STATS_BUCKETS       (24U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Latency samples of one metric, in nanoseconds */
+typedef struct
+{
+    uint32_t    count;
+    uint32_t    min_ns;
+    uint32_t    max_ns;
+    uint64_t    sum_ns;
+    uint32_t    hist[LATENCY_STATS_BUCKETS];
+} latency_stats_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void latency_stats_reset(latency_stats_t* stats);
+void latency_stats_add(latency_stats_t* stats, uint32_t ns);
+uint32_t latency_stats_mean(const latency_stats_t* stats);
+uint32_t latency_stats_percentile(const latency_stats_t* stats, uint32_t pct);
+uint32_t latency_stats_from_edge(uint32_t ticks_late, uint32_t cycles_to_edge,
+                                 uint32_t cycles_per_tick, uint32_t tick_hz);
+size_t latency_stats_format(const latency_stats_t* stats, const char* mode, const char* metric,
+                            char* buf, size_t len);
+
+#endif /* _LATENCY_STATS_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * File Name:   log_ring.c
+ *
+ * Description: This file contains the log ring. Log output is copied into the
+ *              ring and returns at once, the UART driver drains it from its
+ *              interrupt. A message that does not fit is dropped as a whole
+ *              and counted, so the writer never waits for the UART.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "log_ring.h"
+
+#include <string.h>
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: log_ring_init
+********************************************************************************
+* Summary:
+* Initializes an empty ring.
+*
+* Parameters:
+*  ring - ring context
+*  buf - ring storage
+*  size - size of buf in bytes, a power of two
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void log_ring_init(log_ring_t* ring, uint8_t* buf, uint32_t size)
+{
+    ring->buf = buf;
+    ring->size = size;
+    ring->head = 0UL;
+    ring->tail = 0UL;
+    ring->dropped = 0UL;
+    ring->high_water = 0UL;
+}
+
+/*******************************************************************************
+* Function Name: log_ring_write
+********************************************************************************
+* Summary:
+* Copies a message into the ring. Called by the writer only.
+*
+* Parameters:
+*  ring - ring context
+*  data - message
+*  len - message length in bytes
+*
+* Return:
+*  bool - false if the message did not fit and was dropped
+*
+*******************************************************************************/
+bool log_ring_write(log_ring_t* ring, const uint8_t* data, uint32_t len)
+{
+    uint32_t head = ring->head;
+    uint32_t offset = head & (ring->size - 1UL);
+    uint32_t first;
+
+    if (len > log_ring_free(ring))
+    {
+        ring->dropped += len;
+        return false;
+    }
+
+    first = ring->size - offset;
+    if (first > len)
+    {
+        first = len;
+    }
+    (void)memcpy(&ring->buf[offset], data, first);
+    (void)memcpy(ring->buf, &data[first], len - first);
+
+    /* The reader only sees the bytes once they are in the ring */
+    ring->head = head + len;
+
+    if ((head + len - ring->tail) > ring->high_water)
+    {
+        ring->high_water = head + len - ring->tail;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: log_ring_used
+********************************************************************************
+* Summary:
+* Returns the number of bytes held in the ring.
+*
+* Parameters:
+*  ring - ring context
+*
+* Return:
+*  uint32_t - bytes held
+*
+*******************************************************************************/
+uint32_t log_ring_used(const log_ring_t* ring)
+{
+    return ring->head - ring->tail;
+}
+
+/*******************************************************************************
+* Function Name: log_ring_free
+********************************************************************************
+* Summary:
+* Returns the number of bytes that can be written to the ring.
+*
+* Parameters:
+*  ring - ring context
+*
+* Return:
+*  uint32_t - free bytes
+*
+*******************************************************************************/
+uint32_t log_ring_free(const log_ring_t* ring)
+{
+    return ring->size - log_ring_used(ring);
+}
+
+/*******************************************************************************
+* Function Name: log_ring_peek
+********************************************************************************
+* Summary:
+* Returns the oldest bytes of the ring that are contiguous in the storage,
+* without taking them. Called by the reader only.
+*
+* Parameters:
+*  ring - ring context
+*  data - set to the first byte
+*
+* Return:
+*  uint32_t - number of contiguous bytes, 0 if the ring is empty
+*
+*******************************************************************************/
+uint32_t log_ring_peek(const log_ring_t* ring, const uint8_t** data)
+{
+    uint32_t tail = ring->tail;
+    uint32_t offset = tail & (ring->size - 1UL);
+    uint32_t len = ring->head - tail;
+
+    if (len > (ring->size - offset))
+    {
+        len = ring->size - offset;
+    }
+    *data = &ring->buf[offset];
+
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: log_ring_consume
+********************************************************************************
+* Summary:
+* Takes bytes returned by log_ring_peek() out of the ring. Called by the reader
+* only.
+*
+* Parameters:
+*  ring - ring context
+*  len - number of bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void log_ring_consume(log_ring_t* ring, uint32_t len)
+{
+    ring->tail += len;
+}
+
+/* [] END OF FILE */
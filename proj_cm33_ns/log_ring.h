@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * File Name:   log_ring.h
+ *
+ * Description: This file is the public interface of log_ring.c, the byte ring
+ *              that decouples log output from the debug UART.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _LOG_RING_H_
+#define _LOG_RING_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The ring only depends on the C library so it can be built on the host */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Byte ring with a single writer and a single reader, which may preempt the
+ * writer. Each index is written by one side only, so no lock is needed. */
+typedef struct
+{
+    uint8_t*            buf;
+    uint32_t            size;       /* Size of buf, a power of two */
+    volatile uint32_t   head;       /* Written by the writer */
+    volatile uint32_t   tail;       /* Written by the reader */
+    uint32_t            dropped;    /* Bytes lost on a full ring */
+    uint32_t            high_water; /* Largest number of bytes held */
+} log_ring_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void log_ring_init(log_ring_t* ring, uint8_t* buf, uint32_t size);
+bool log_ring_write(log_ring_t* ring, const uint8_t* data, uint32_t len);
+uint32_t log_ring_used(const log_ring_t* ring);
+uint32_t log_ring_free(const log_ring_t* ring);
+uint32_t log_ring_peek(const log_ring_t* ring, const uint8_t** data);
+void log_ring_consume(log_ring_t* ring, uint32_t len);
+
+#endif /* _LOG_RING_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ * File Name:   log_token.c
+ *
+ * Description: This file contains the tokenized logging. The messages are
+ *              listed in the dictionary log_tokens.def. Built with
+ *              LOG_TOKENIZED, only the token ID and the raw arguments of a
+ *              message are sent, in a console frame, and the format strings
+ *              are not part of the image. The host decoder formats them.
+ *              Otherwise, the messages are printed as text.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "log_token.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "console.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+#if defined(LOG_TOKENIZED)
+/* Argument signature of every token */
+static const char* const log_token_signatures[LOG_TOKEN_MAX] =
+{
+#define LOG_TOKEN(name, signature, format) signature,
+#include "log_tokens.def"
+#undef LOG_TOKEN
+};
+
+/* Writes a whole frame, or drops it */
+static void (*log_token_write)(const uint8_t* data, uint32_t len) = NULL;
+
+/* Sequence number of the next log frame, a gap shows dropped messages */
+static uint8_t log_token_seq = 0U;
+#else
+static const char* const log_token_formats[LOG_TOKEN_MAX] =
+{
+#define LOG_TOKEN(name, signature, format) format,
+#include "log_tokens.def"
+#undef LOG_TOKEN
+};
+#endif /* defined(LOG_TOKENIZED) */
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: log_token_init
+********************************************************************************
+* Summary:
+* Sets the output of the tokenized messages and sends the size of the
+* dictionary, so that the decoder can tell a stale dictionary. Does nothing
+* when the messages are printed as text.
+*
+* Parameters:
+*  write - writes a whole frame, it should drop the frame rather than wait
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void log_token_init(void (*write)(const uint8_t* data, uint32_t len))
+{
+#if defined(LOG_TOKENIZED)
+    log_token_write = write;
+    log_token(LOG_TOKEN_LOG_DICT, (uint32_t)LOG_TOKEN_MAX);
+#else
+    (void)write;
+#endif /* defined(LOG_TOKENIZED) */
+}
+
+/*******************************************************************************
+* Function Name: log_token
+********************************************************************************
+* Summary:
+* Logs a message of the dictionary. The arguments must match the signature of
+* the token: a uint32_t or int for 'u', a NUL-terminated string for 's'.
+*
+* Parameters:
+*  id - token ID
+*  ... - arguments
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void log_token(log_token_id_t id, ...)
+{
+    va_list args;
+#if defined(LOG_TOKENIZED)
+    uint8_t frame[CONSOLE_HEADER_LEN + LOG_TOKEN_PAYLOAD_MAX + CONSOLE_TRAILER_LEN];
+    uint8_t* payload = &frame[CONSOLE_HEADER_LEN];
+    uint32_t len = 2UL;
+
+    if ((NULL == log_token_write) || ((uint32_t)id >= (uint32_t)LOG_TOKEN_MAX))
+    {
+        return;
+    }
+
+    payload[0] = (uint8_t)id;
+    payload[1] = (uint8_t)((uint32_t)id >> 8U);
+
+    va_start(args, id);
+    for (const char* sig = log_token_signatures[id]; '\0' != *sig; sig++)
+    {
+        if ('s' == *sig)
+        {
+            const char* str = va_arg(args, const char*);
+            uint32_t n = (uint32_t)strlen(str);
+
+            if (len >= LOG_TOKEN_PAYLOAD_MAX)
+            {
+                break;
+            }
+
+            /* Length byte, then the characters */
+            if (n > (LOG_TOKEN_PAYLOAD_MAX - len - 1UL))
+            {
+                n = LOG_TOKEN_PAYLOAD_MAX - len - 1UL;
+            }
+            payload[len++] = (uint8_t)n;
+            (void)memcpy(&payload[len], str, n);
+            len += n;
+        }
+        else if (!console_put_u32(payload, &len, LOG_TOKEN_PAYLOAD_MAX, va_arg(args, uint32_t)))
+        {
+            break;
+        }
+    }
+    va_end(args);
+
+    log_token_write(frame, console_frame(frame, CONSOLE_FRAME_LOG, log_token_seq++, len));
+#else
+    if ((uint32_t)id >= (uint32_t)LOG_TOKEN_MAX)
+    {
+        return;
+    }
+
+    va_start(args, id);
+    (void)vprintf(log_token_formats[id], args);
+    va_end(args);
+#endif /* defined(LOG_TOKENIZED) */
+}
+
+/* [] END OF FILE */
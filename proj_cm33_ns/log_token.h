@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * File Name:   log_token.h
+ *
+ * Description: This file is the public interface of log_token.c, the
+ *              tokenized logging used for the messages printed at run time.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _LOG_TOKEN_H_
+#define _LOG_TOKEN_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* Logging only depends on the C library so it can be built on the host */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Largest payload of a log frame: token ID and arguments. Strings are
+ * shortened to fit. */
+#define LOG_TOKEN_PAYLOAD_MAX       (48U)
+
+/* Passes a name from a fixed table: the name itself when the messages are
+ * printed as text, its index when they are tokenized. The token has 'u' in its
+ * signature and %s in its format for it, and tools/log_decode.py holds the
+ * table, so the names are not sent. */
+#if defined(LOG_TOKENIZED)
+#define LOG_TOKEN_NAME(index, name) ((uint32_t)(index))
+#else
+#define LOG_TOKEN_NAME(index, name) (name)
+#endif /* defined(LOG_TOKENIZED) */
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Token IDs, in dictionary order */
+typedef enum
+{
+#define LOG_TOKEN(name, signature, format) LOG_TOKEN_##name,
+#include "log_tokens.def"
+#undef LOG_TOKEN
+    LOG_TOKEN_MAX
+} log_token_id_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void log_token_init(void (*write)(const uint8_t* data, uint32_t len));
+void log_token(log_token_id_t id, ...);
+
+#endif /* _LOG_TOKEN_H_ */
+
+/* [] END OF FILE */
@@ -40,87 +40,1531 @@
 * Header Files
 *******************************************************************************/
 
+#include <string.h>
+
 #include "cybsp.h"
 #include "retarget_io_init.h"
+#include "reg_snapshot.h"
+#include "warm_boot.h"
+#include "latency_bench.h"
+#include "throughput_bench.h"
+#include "dvfs_governor.h"
+#include "event_sched.h"
+#include "event_sched_port.h"
+#include "debounce.h"
+#include "perf_vote.h"
+#include "ipc_shared.h"
+#include "ipc_doorbell.h"
+#include "job_ring.h"
+#include "cm55_offload.h"
+#include "scenario_run.h"
+#include "timebase.h"
+#include "console.h"
+#include "log_token.h"
+#include "trace.h"
+
+#include "user_srf.h"
+#include "user_syspm_srf.h"
+
+/*****************************************************************************
+* Macros and Structures
+*****************************************************************************/
+
+/* LED toggle delay. The LED is toggled from an LPTimer-based timer, so the delay
+ * holds in every power mode. */
+#define BLINKY_LED_DELAY_MSEC (500U)
+
+/* The timeout value in microseconds used to wait for CM55 core to be booted */
+#define CM55_BOOT_WAIT_TIME_USEC (10U)
+
+/* USER BTN1 interrupt priority */
+#define BTN_IRQ_PRIORITY (7U)
+
+/* CM55 doorbell interrupt priority */
+#define CM55_DOORBELL_IRQ_PRIORITY (7U)
+
+/* Time a button must be stable before a press or release is accepted */
+#define BTN_DEBOUNCE_MSEC (20U)
+
+/* Retained storage for the register snapshot, in words */
+#define REG_SNAPSHOT_STORAGE_WORDS (32U)
+
+/* String unique to the build, a warm-boot record armed by another image is ignored */
+#define WARM_BOOT_BUILD_STR (__DATE__ " " __TIME__)
+
+/* Boot phases whose state survives DS-OFF and Hibernate. The start-up messages
+ * are already on the terminal and the CM55 image was booted once, so the warm
+ * path neither prints them again nor waits for CM55 indefinitely. The hardware
+ * and the .data/.bss sections are reset by the wake-up, so the BSP, the SRF pool
+ * and retarget-io are always initialized. */
+#define WARM_BOOT_PRESERVED ((1UL << WARM_BOOT_PHASE_CM55) | (1UL << WARM_BOOT_PHASE_BANNER))
+
+/* Warm-boot context words */
+#define WARM_BOOT_CTX_PWR_LEVEL (0U)
+
+/* Wake-up source of DS-OFF and Hibernate entered from the console, the
+ * hibernate wake-up pin 0 going low */
+#define DEEP_OFF_WAKEUP_SRC ((uint32_t)CY_SYSPM_HIBERNATE_PIN0_LOW)
+
+/* Governor policy, one of dvfs_policy_ondemand, dvfs_policy_conservative or
+ * dvfs_policy_race_to_idle */
+#define GOVERNOR_POLICY (&dvfs_policy_ondemand)
+
+/* Length of a governor load window */
+#define GOVERNOR_WINDOW_MSEC (100U)
+
+/* Scheduler events */
+#define APP_EVENT_BTN_EDGE (0U)     /* Button edge, posted from the GPIO interrupt */
+#define APP_EVENT_BUTTON   (1U)     /* Debounced button change queued */
+#define APP_EVENT_CM55     (2U)     /* CM55 vote changed or jobs done, posted from the doorbell interrupt */
+#define APP_EVENT_CONSOLE  (3U)     /* Debug UART bytes received or RX pin wake-up */
+
+/* Deep Sleep is held off for this long after the last console input, the
+ * SCB does not receive in Deep Sleep */
+#define CONSOLE_AWAKE_MSEC (2000U)
+
+/* Console event IDs, first byte of an event frame */
+#define CONSOLE_EVENT_SCENARIO_DONE (1U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Event scheduler running the main loop, the CPU sleeps between events */
+static event_sched_t app_sched;
+static event_sched_timer_t led_timer;
+static event_sched_timer_t governor_timer;
+
+/* Button debounce service */
+static debounce_t btn_debounce;
+static debounce_input_t btn1_input;
+
+/* Set while the application is parked in Deep Sleep by BTN1 */
+static bool app_parked = false;
+
+/* Set while the CM55 is powered off from the console */
+static bool cm55_off = false;
+
+/* Power mode governor */
+static dvfs_governor_t governor;
+
+/* Performance level votes, the aggregate level is carried across DS-OFF and
+ * Hibernate */
+static perf_vote_t perf_votes;
+static perf_vote_client_t governor_client;
+static perf_vote_client_t cm55_client;
+static perf_vote_client_t console_client;
+
+/* Set while the power mode is pinned from the console */
+static bool governor_paused = false;
+
+static const dvfs_governor_cfg_t governor_cfg =
+{
+    .up_pct = 80U,
+    .down_pct = 30U,
+    .down_windows = 3U,
+    .min_interval_ms = 300U
+};
+
+#if !defined(LOG_TOKENIZED)
+/* Tokenized messages carry the level, tools/log_decode.py holds the names */
+static const char* const power_level_names[DVFS_LEVEL_MAX] =
+{
+    "Ultra Low Power", "Low Power", "High Performance"
+};
+#endif /* !defined(LOG_TOKENIZED) */
+
+/* Command console on the debug UART */
+static console_t app_console;
+static event_sched_timer_t console_timer;
+static bool console_awake = false;
+
+static console_status_t console_cmd_ping(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len);
+static console_status_t console_cmd_mode(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len);
+static console_status_t console_cmd_counters(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len);
+static console_status_t console_cmd_park(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len);
+static console_status_t console_cmd_residency(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len);
+static console_status_t console_cmd_state(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len);
+static console_status_t console_cmd_cm55(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len);
+#if defined(SCENARIO_PLAYBACK)
+static console_status_t console_cmd_scenario(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len);
+#endif /* defined(SCENARIO_PLAYBACK) */
+
+static const console_cmd_t console_cmds[] =
+{
+    { "ping", console_cmd_ping },
+    { "mode", console_cmd_mode },
+    { "counters", console_cmd_counters },
+    { "park", console_cmd_park },
+    { "residency", console_cmd_residency },
+    { "state", console_cmd_state },
+    { "cm55", console_cmd_cm55 },
+#if defined(SCENARIO_PLAYBACK)
+    { "scenario", console_cmd_scenario },
+#endif /* defined(SCENARIO_PLAYBACK) */
+};
+
+/* Warm-boot record. DS-OFF and Hibernate power off the SRAM, so the record is
+ * kept in the backup-domain registers and copied here at boot. */
+static warm_boot_record_t warm_boot_record;
+
+/* The record must fit in the backup-domain words */
+_Static_assert(sizeof(warm_boot_record_t) <= sizeof(cy_stc_user_syspm_backup_t),
+               "warm-boot record does not fit in the backup registers");
+
+/* Boot-phase timing in CPU cycles */
+static warm_boot_timing_t warm_boot_timing;
+
+/* Warm-boot callback for DS-OFF and Hibernate */
+cy_en_syspm_status_t warm_boot_syspm_callback(cy_stc_syspm_callback_params_t *callbackParams,
+                                              cy_en_syspm_callback_mode_t mode);
+
+static cy_stc_syspm_callback_params_t warm_boot_syspm_params = {NULL, NULL};
+
+static cy_stc_syspm_callback_t warm_boot_ds_off_syspm_cb =
+{
+    .callback = &warm_boot_syspm_callback,
+    .type = CY_SYSPM_DEEPSLEEP_OFF,
+    .skipMode = 0U,
+    .callbackParams = &warm_boot_syspm_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = 255U
+};
+
+static cy_stc_syspm_callback_t warm_boot_hibernate_syspm_cb =
+{
+    .callback = &warm_boot_syspm_callback,
+    .type = CY_SYSPM_HIBERNATE,
+    .skipMode = 0U,
+    .callbackParams = &warm_boot_syspm_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = 255U
+};
+
+/* Register snapshot taken before Deep Sleep RAM and restored after wake-up */
+static reg_snapshot_t reg_snapshot;
+static uint32_t reg_snapshot_storage[REG_SNAPSHOT_STORAGE_WORDS];
+
+/* Debug UART configuration registers, the enable register is restored last */
+static const reg_snapshot_run_t debug_uart_snapshot_runs[] =
+{
+    { &CYBSP_DEBUG_UART_HW->UART_CTRL, 3U },    /* UART_CTRL, UART_TX_CTRL, UART_RX_CTRL */
+    { &CYBSP_DEBUG_UART_HW->TX_CTRL, 2U },     /* TX_CTRL, TX_FIFO_CTRL */
+    { &CYBSP_DEBUG_UART_HW->RX_CTRL, 1U },
+    { &CYBSP_DEBUG_UART_HW->INTR_RX_MASK, 1U },
+    { &CYBSP_DEBUG_UART_HW->CTRL, 1U }
+};
+
+static reg_snapshot_desc_t debug_uart_snapshot_desc =
+{
+    .runs = debug_uart_snapshot_runs,
+    .num_runs = sizeof(debug_uart_snapshot_runs) / sizeof(debug_uart_snapshot_runs[0]),
+    .next = NULL
+};
+
+/* Register snapshot callback for Deep Sleep RAM */
+cy_en_syspm_status_t reg_snapshot_syspm_callback(cy_stc_syspm_callback_params_t *callbackParams,
+                                                 cy_en_syspm_callback_mode_t mode);
+
+static cy_stc_syspm_callback_params_t reg_snapshot_syspm_params = {NULL, NULL};
+
+static cy_stc_syspm_callback_t reg_snapshot_syspm_cb =
+{
+    .callback = &reg_snapshot_syspm_callback,
+    .type = CY_SYSPM_DEEPSLEEP_RAM,
+    .skipMode = 0U,
+    .callbackParams = &reg_snapshot_syspm_params,
+    .prevItm = NULL,
+    .nextItm = NULL,
+    .order = 0U
+};
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+
+/********************************************************************************
+ * Function Name: check_status
+ ********************************************************************************
+ * Summary:
+ *  Checks for non-zero status, and prints success/error message accordingly.
+ *  Indicates the non-zero status by turning the LED1 on, and asserts the
+ *  non-zero status.
+ *
+ * Parameters:
+ *  status - status for evaluation.
+ *
+ * Return:
+ *  void
+ *
+ *******************************************************************************/
+void check_status(cy_rslt_t status)
+{
+    if (CY_RSLT_SUCCESS != status)
+    {
+        /* Print Error message */
+        log_token(LOG_TOKEN_STATUS_FAILED, (uint32_t)status);
+
+        /* Turn on the LED1*/
+        Cy_GPIO_Set(CYBSP_USER_LED1_PORT, CYBSP_USER_LED1_PIN);
+        handle_app_error();
+    }
+    else
+    {
+        /* Print Success message */
+        log_token(LOG_TOKEN_STATUS_OK);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: reg_snapshot_syspm_callback
+********************************************************************************
+* Summary:
+*  SysPm callback for Deep Sleep RAM. Saves the registered peripheral registers
+*  into retained RAM before entry and restores them in one pass after wake-up.
+*
+* Parameters:
+*  callbackParams - unused
+*  mode - SysPm callback mode
+*
+* Return:
+*  cy_en_syspm_status_t
+*
+*******************************************************************************/
+cy_en_syspm_status_t reg_snapshot_syspm_callback(cy_stc_syspm_callback_params_t *callbackParams,
+                                                 cy_en_syspm_callback_mode_t mode)
+{
+    CY_UNUSED_PARAMETER(callbackParams);
+
+    if (CY_SYSPM_BEFORE_TRANSITION == mode)
+    {
+        reg_snapshot_save(&reg_snapshot);
+    }
+    else if (CY_SYSPM_AFTER_TRANSITION == mode)
+    {
+        (void)reg_snapshot_restore(&reg_snapshot);
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: init_reg_snapshot
+********************************************************************************
+* Summary:
+*  Initializes the register snapshot engine, registers the peripherals whose
+*  context must survive Deep Sleep RAM and the SysPm callback that drives it.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void init_reg_snapshot(void)
+{
+    reg_snapshot_init(&reg_snapshot, reg_snapshot_storage, REG_SNAPSHOT_STORAGE_WORDS);
+
+    if (!reg_snapshot_register(&reg_snapshot, &debug_uart_snapshot_desc))
+    {
+        handle_app_error();
+    }
+
+    Cy_SysPm_RegisterCallback(&reg_snapshot_syspm_cb);
+}
+
+
+/*******************************************************************************
+* Function Name: warm_boot_store
+********************************************************************************
+* Summary:
+*  Writes the warm-boot record to the backup-domain registers. If the write
+*  fails, the next wake-up takes the cold path.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void warm_boot_store(void)
+{
+    cy_stc_user_syspm_backup_t backup = {{0UL}};
+
+    memcpy(backup.words, &warm_boot_record, sizeof(warm_boot_record));
+    (void)Cy_USER_SysSetBackup(&backup);
+}
+
+
+/*******************************************************************************
+* Function Name: warm_boot_load
+********************************************************************************
+* Summary:
+*  Reads the warm-boot record from the backup-domain registers. The record
+*  stays cleared, which selects the cold path, if the read fails.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void warm_boot_load(void)
+{
+    cy_stc_user_syspm_backup_t backup;
+
+    if (CY_USER_SYSPM_SUCCESS == Cy_USER_SysGetBackup(&backup))
+    {
+        memcpy(&warm_boot_record, backup.words, sizeof(warm_boot_record));
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: warm_boot_syspm_callback
+********************************************************************************
+* Summary:
+*  SysPm callback for DS-OFF and Hibernate. Arms the warm-boot record with the
+*  power mode state right before entry, and disarms it if the entry fails. It
+*  is registered last so that the record is armed only once every other
+*  callback agreed to the transition.
+*
+* Parameters:
+*  callbackParams - unused
+*  mode - SysPm callback mode
+*
+* Return:
+*  cy_en_syspm_status_t
+*
+*******************************************************************************/
+cy_en_syspm_status_t warm_boot_syspm_callback(cy_stc_syspm_callback_params_t *callbackParams,
+                                              cy_en_syspm_callback_mode_t mode)
+{
+    uint32_t context[WARM_BOOT_CONTEXT_WORDS] = {0UL};
+
+    CY_UNUSED_PARAMETER(callbackParams);
+
+    if (CY_SYSPM_BEFORE_TRANSITION == mode)
+    {
+        context[WARM_BOOT_CTX_PWR_LEVEL] = (uint32_t)perf_votes.level;
+
+        warm_boot_arm(&warm_boot_record, warm_boot_image_id(WARM_BOOT_BUILD_STR),
+                      WARM_BOOT_PRESERVED, context);
+        warm_boot_store();
+    }
+    else if ((CY_SYSPM_AFTER_TRANSITION == mode) || (CY_SYSPM_CHECK_FAIL == mode))
+    {
+        /* Returning here means the device did not go through the reset */
+        warm_boot_disarm(&warm_boot_record);
+        warm_boot_store();
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: cpu_cycles
+********************************************************************************
+* Summary:
+*  Returns the CPU cycle counter used for the boot-phase timing. The counter
+*  is started on the first call.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - CPU cycles
+*
+*******************************************************************************/
+static uint32_t cpu_cycles(void)
+{
+    if (0UL == (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0UL;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    return DWT->CYCCNT;
+}
+
+
+/*******************************************************************************
+* Function Name: print_boot_timing
+********************************************************************************
+* Summary:
+*  Prints the duration of every boot phase. Must be called before the power
+*  mode is changed, the cycles were counted at the start-up clock.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_boot_timing(void)
+{
+    static const char* const phase_names[WARM_BOOT_PHASE_MAX] =
+    {
+        "bsp", "srf", "retarget-io", "app", "cm55", "banner"
+    };
+    uint32_t cycles_per_us = SystemCoreClock / 1000000UL;
+    uint32_t total = 0UL;
+
+    printf(" %s boot:", warm_boot_timing.warm ? "Warm" : "Cold");
+
+    for (uint32_t i = 0U; i < (uint32_t)WARM_BOOT_PHASE_MAX; i++)
+    {
+        uint32_t cycles = warm_boot_timing_phase(&warm_boot_timing, (warm_boot_phase_t)i);
+
+        total += cycles;
+        printf(" %s %u us%s", phase_names[i], (unsigned int)(cycles / cycles_per_us),
+               (i < ((uint32_t)WARM_BOOT_PHASE_MAX - 1U)) ? "," : "\r\n");
+    }
+
+    printf(" Total: %u us\r\n\n", (unsigned int)(total / cycles_per_us));
+}
+
+
+/*******************************************************************************
+* Function Name: set_power_level
+********************************************************************************
+* Summary:
+*  Moves the device from one performance level to another. Ultra Low Power mode
+*  is entered from and left through Low Power mode, so the transition goes
+*  through the levels in between.
+*
+* Parameters:
+*  from - current level
+*  to - requested level
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void set_power_level(dvfs_level_t from, dvfs_level_t to)
+{
+    cy_en_user_syspm_status_t status = CY_USER_SYSPM_SUCCESS;
+
+    while ((from != to) && (CY_USER_SYSPM_SUCCESS == status))
+    {
+        from = (from < to) ? (dvfs_level_t)(from + 1U) : (dvfs_level_t)(from - 1U);
+
+        /* The debug UART drains through its transition notifier */
+        switch (from)
+        {
+            case DVFS_LEVEL_HP:
+                status = Cy_USER_SysEnterHp();
+                break;
+
+            case DVFS_LEVEL_LP:
+                status = Cy_USER_SysEnterLp();
+                break;
+
+            default:
+                status = Cy_USER_SysEnterUlp();
+                break;
+        }
+    }
+
+    if (CY_USER_SYSPM_SUCCESS != status)
+    {
+        check_status((cy_rslt_t)status);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: apply_perf_level
+********************************************************************************
+* Summary:
+*  Applies the aggregate of the performance level votes.
+*
+* Parameters:
+*  from - current level
+*  to - new level
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void apply_perf_level(dvfs_level_t from, dvfs_level_t to, void* arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    log_token(LOG_TOKEN_PERF_LEVEL, LOG_TOKEN_NAME(to, power_level_names[to]),
+              LOG_TOKEN_NAME(perf_vote_holder_id(&perf_votes), perf_vote_holder_name(&perf_votes)));
+
+    set_power_level(from, to);
+}
+
+
+/*******************************************************************************
+* Function Name: governor_update
+********************************************************************************
+* Summary:
+*  Feeds the busy and idle time of the last window to the governor and votes
+*  for the level it returns.
+*
+* Parameters:
+*  busy - time spent working in the window
+*  idle - time spent sleeping in the window
+*  now_ms - governor time in milliseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void governor_update(uint32_t busy, uint32_t idle, uint32_t now_ms)
+{
+    dvfs_level_t level = governor.level;
+
+    if (level != dvfs_governor_sample(&governor, busy, idle, now_ms))
+    {
+        log_token(LOG_TOKEN_GOVERNOR, LOG_TOKEN_NAME(governor.policy->id, governor.policy->name), governor.load_pct,
+                  LOG_TOKEN_NAME(governor.level, power_level_names[governor.level]));
+
+        perf_vote_set(&perf_votes, &governor_client, governor.level);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: led_timer_cb
+********************************************************************************
+* Summary:
+*  Scheduler timer callback, toggles LED1.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void led_timer_cb(void* arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    Cy_GPIO_Inv(CYBSP_USER_LED1_PORT, CYBSP_USER_LED1_PIN);
+}
+
+
+/*******************************************************************************
+* Function Name: governor_timer_cb
+********************************************************************************
+* Summary:
+*  Scheduler timer callback, feeds the load of the last window to the governor.
+*  The load is the share of the window the CPU spent out of the scheduler idle
+*  state.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void governor_timer_cb(void* arg)
+{
+    uint32_t busy;
+    uint32_t idle;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    event_sched_take_load(&app_sched, &busy, &idle);
+
+    /* The load is still taken so that it does not pile up while paused */
+    if (!governor_paused)
+    {
+        governor_update(busy, idle, timebase_ms());
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: start_app_timers
+********************************************************************************
+* Summary:
+*  Starts the LED, governor and CM55 offload timers.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void start_app_timers(void)
+{
+    event_sched_timer_start(&app_sched, &led_timer, EVENT_SCHED_MS_TO_TICKS(BLINKY_LED_DELAY_MSEC),
+                            EVENT_SCHED_MS_TO_TICKS(BLINKY_LED_DELAY_MSEC), led_timer_cb, NULL);
+    event_sched_timer_start(&app_sched, &governor_timer, EVENT_SCHED_MS_TO_TICKS(GOVERNOR_WINDOW_MSEC),
+                            EVENT_SCHED_MS_TO_TICKS(GOVERNOR_WINDOW_MSEC), governor_timer_cb, NULL);
+#if defined(CM55_OFFLOAD_DEMO)
+    if (!cm55_off)
+    {
+        cm55_offload_start();
+    }
+#endif /* defined(CM55_OFFLOAD_DEMO) */
+}
+
+
+#if defined(SCENARIO_PLAYBACK)
+/*******************************************************************************
+* Function Name: scenario_done
+********************************************************************************
+* Summary:
+*  Called when the scenario run is complete, in HP mode. Applies the voted
+*  performance level again and starts the application timers.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void scenario_done(void)
+{
+    uint8_t event = CONSOLE_EVENT_SCENARIO_DONE;
+
+    set_power_level(DVFS_LEVEL_HP, perf_votes.level);
+
+    /* The scenario is not part of the load */
+    event_sched_take_load(&app_sched, NULL, NULL);
+    start_app_timers();
+
+    console_send(&app_console, CONSOLE_FRAME_EVENT, &event, sizeof(event));
+}
+#endif /* defined(SCENARIO_PLAYBACK) */
+
+
+/*******************************************************************************
+* Function Name: btn1_read
+********************************************************************************
+* Summary:
+*  Returns the level of BTN1 for the debounce service.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool - true while BTN1 is pressed
+*
+*******************************************************************************/
+static bool btn1_read(void)
+{
+    return (CYBSP_BTN_PRESSED == Cy_GPIO_Read(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN));
+}
+
+
+/*******************************************************************************
+* Function Name: toggle_parked
+********************************************************************************
+* Summary:
+*  Handles a BTN1 press. The first press stops the application timers, so with
+*  nothing left to run the scheduler keeps the device in Deep Sleep. The next
+*  press starts them again.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void toggle_parked(void)
+{
+    if (!app_parked)
+    {
+        log_token(LOG_TOKEN_DS_ENTER);
+
+        event_sched_timer_stop(&app_sched, &led_timer);
+        event_sched_timer_stop(&app_sched, &governor_timer);
+#if defined(CM55_OFFLOAD_DEMO)
+        cm55_offload_stop();
+#endif /* defined(CM55_OFFLOAD_DEMO) */
+        Cy_GPIO_Clr(CYBSP_USER_LED1_PORT, CYBSP_USER_LED1_PIN);
+    }
+    else
+    {
+        log_token(LOG_TOKEN_DS_WAKE, LOG_TOKEN_NAME(perf_votes.level, power_level_names[perf_votes.level]));
+
+        /* The time in Deep Sleep is not part of the load */
+        event_sched_take_load(&app_sched, NULL, NULL);
+        start_app_timers();
+    }
+
+    app_parked = !app_parked;
+}
+
+
+/*******************************************************************************
+* Function Name: button_event_cb
+********************************************************************************
+* Summary:
+*  Scheduler event callback, drains the debounced button changes. Only presses
+*  are acted on.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void button_event_cb(void* arg)
+{
+    debounce_event_t event;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    while (debounce_pop(&btn_debounce, &event))
+    {
+#if defined(SCENARIO_PLAYBACK)
+        /* The scenario owns the power mode while it runs */
+        if (scenario_run_active())
+        {
+            continue;
+        }
+#endif /* defined(SCENARIO_PLAYBACK) */
+
+        if (event.active)
+        {
+            toggle_parked();
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: cm55_event_cb
+********************************************************************************
+* Summary:
+*  Scheduler event callback for the CM55 doorbell. Takes the vote the CM55 left
+*  in its mailbox and reports the jobs it completed. A doorbell rung before the
+*  CM55 was powered off is ignored, its vote was withdrawn.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void cm55_event_cb(void* arg)
+{
+    uint32_t level;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    if (cm55_off)
+    {
+        return;
+    }
+
+    ipc_shared_fetch(&IPC_SHARED->cm55_vote, sizeof(IPC_SHARED->cm55_vote));
+    level = IPC_SHARED->cm55_vote.level;
+
+    if (level < (uint32_t)DVFS_LEVEL_MAX)
+    {
+        perf_vote_set(&perf_votes, &cm55_client, (dvfs_level_t)level);
+    }
+    else
+    {
+        perf_vote_release(&perf_votes, &cm55_client);
+    }
+
+#if defined(CM55_OFFLOAD_DEMO)
+    cm55_offload_completed();
+#endif /* defined(CM55_OFFLOAD_DEMO) */
+}
+
+
+/*******************************************************************************
+* Function Name: cm55_doorbell_isr
+********************************************************************************
+* Summary:
+*  CM55 doorbell interrupt handler.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void cm55_doorbell_isr(void)
+{
+    TRACE_ISR_BEGIN();
+    ipc_doorbell_clear(IPC_DOORBELL_CM33);
+    TRACE_INSTANT(TRACE_EV_IPC_ACK, IPC_DOORBELL_CM33);
+    event_sched_post(&app_sched, APP_EVENT_CM55);
+    TRACE_ISR_END();
+}
+
+
+/*******************************************************************************
+* Function Name: cm55_power_off
+********************************************************************************
+* Summary:
+*  Powers off the CM55 and its application domain. The CM55 vote is withdrawn
+*  first, so the performance level no longer follows it. Once the CM55 is held
+*  in reset, the job ring has no consumer and is cleared, queued jobs are
+*  dropped.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool - true if the CM55 was powered off
+*
+*******************************************************************************/
+static bool cm55_power_off(void)
+{
+    IPC_SHARED->cm55_vote.level = IPC_VOTE_NONE;
+    ipc_shared_publish(&IPC_SHARED->cm55_vote, sizeof(IPC_SHARED->cm55_vote));
+    perf_vote_release(&perf_votes, &cm55_client);
+    cm55_off = true;
+
+    if (CY_USER_SYSPM_SUCCESS != Cy_USER_SysCm55PowerOff())
+    {
+        return false;
+    }
+
+#if defined(CM55_OFFLOAD_DEMO)
+    cm55_offload_reset();
+#else
+    job_ring_init(&IPC_SHARED->jobs, ipc_shared_publish);
+#endif /* defined(CM55_OFFLOAD_DEMO) */
+
+    log_token(LOG_TOKEN_CM55_OFF);
+
+    return true;
+}
+
+
+/*******************************************************************************
+* Function Name: cm55_power_on
+********************************************************************************
+* Summary:
+*  Restarts the CM55 from its boot image after cm55_power_off() and resumes the
+*  offload jobs if the application timers run. Logs the restart latency.
+*
+* Parameters:
+*  restart - returns the restart latency and whether the image was validated
+*
+* Return:
+*  bool - true if the CM55 was started
+*
+*******************************************************************************/
+static bool cm55_power_on(cy_stc_user_syspm_cm55_restart_t* restart)
+{
+    if (CY_USER_SYSPM_SUCCESS != Cy_USER_SysCm55PowerOn(CY_SYS_CORE_WAIT_INFINITE, restart))
+    {
+        return false;
+    }
+    cm55_off = false;
+
+    log_token(LOG_TOKEN_CM55_ON, restart->restart_us, restart->validated);
+
+#if defined(CM55_OFFLOAD_DEMO)
+    if (!app_parked)
+    {
+        cm55_offload_start();
+    }
+#endif /* defined(CM55_OFFLOAD_DEMO) */
+
+    return true;
+}
+
+
+/*******************************************************************************
+* Function Name: console_rx_notify
+********************************************************************************
+* Summary:
+*  Called by the debug UART interrupts when bytes were received or the RX pin
+*  woke the device up.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void console_rx_notify(void)
+{
+    event_sched_post(&app_sched, APP_EVENT_CONSOLE);
+}
+
+
+/*******************************************************************************
+* Function Name: console_timer_cb
+********************************************************************************
+* Summary:
+*  Scheduler timer callback, the console was quiet for CONSOLE_AWAKE_MSEC.
+*  Allows Deep Sleep again and arms the RX pin to wake the device up on the
+*  next command.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void console_timer_cb(void* arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    console_awake = false;
+    event_sched_port_hold_ds(false);
+    retarget_io_arm_rx_wake();
+}
+
+
+/*******************************************************************************
+* Function Name: console_event_cb
+********************************************************************************
+* Summary:
+*  Scheduler event callback, feeds the received bytes to the console. Deep
+*  Sleep is held off while the console is in use, so that the following bytes
+*  of a command are received.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void console_event_cb(void* arg)
+{
+    uint8_t buf[16];
+    uint32_t count;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    while (0UL != (count = retarget_io_read(buf, sizeof(buf))))
+    {
+        console_input(&app_console, buf, count);
+    }
+
+    if (!console_awake)
+    {
+        console_awake = true;
+        event_sched_port_hold_ds(true);
+    }
+    event_sched_timer_start(&app_sched, &console_timer, EVENT_SCHED_MS_TO_TICKS(CONSOLE_AWAKE_MSEC), 0UL,
+                            console_timer_cb, NULL);
+}
+
+
+/*******************************************************************************
+* Function Name: console_cmd_ping
+********************************************************************************
+* Summary:
+*  Console command "ping". Responds with the uptime in milliseconds and the
+*  CPU clock frequency in Hz.
+*
+* Parameters:
+*  argc - number of words
+*  argv - words of the command line
+*  rsp - response data
+*  len - in: size of rsp, out: response data length
+*
+* Return:
+*  console_status_t - command status
+*
+*******************************************************************************/
+static console_status_t console_cmd_ping(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len)
+{
+    uint32_t pos = 0UL;
+
+    CY_UNUSED_PARAMETER(argv);
+
+    if (1UL != argc)
+    {
+        return CONSOLE_STATUS_BAD_ARGS;
+    }
+
+    (void)console_put_u32(rsp, &pos, *len, timebase_ms());
+    (void)console_put_u32(rsp, &pos, *len, SystemCoreClock);
+    *len = pos;
+
+    return CONSOLE_STATUS_OK;
+}
+
+
+/*******************************************************************************
+* Function Name: console_cmd_mode
+********************************************************************************
+* Summary:
+*  Console command "mode hp|lp|ulp|auto|dsoff|hibernate". Pins the power mode,
+*  the governor is paused until "mode auto" hands the mode back to it. Other
+*  votes, such as the CM55 one, can still raise the mode. Responds with the
+*  resulting level. "dsoff" and "hibernate" enter DS-OFF or Hibernate until
+*  DEEP_OFF_WAKEUP_SRC wakes up the device through a reset. They only respond
+*  when the entry fails, the warm-boot timing is printed after the wake-up.
+*
+* Parameters:
+*  argc - number of words
+*  argv - words of the command line
+*  rsp - response data
+*  len - in: size of rsp, out: response data length
+*
+* Return:
+*  console_status_t - command status
+*
+*******************************************************************************/
+static console_status_t console_cmd_mode(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len)
+{
+    uint32_t pos = 0UL;
 
-#include "user_srf.h"
-#include "user_syspm_srf.h"
+    if (2UL != argc)
+    {
+        return CONSOLE_STATUS_BAD_ARGS;
+    }
 
-/*****************************************************************************
-* Macros and Structures
-*****************************************************************************/
+#if defined(SCENARIO_PLAYBACK)
+    /* The scenario owns the power mode while it runs */
+    if (scenario_run_active())
+    {
+        return CONSOLE_STATUS_BUSY;
+    }
+#endif /* defined(SCENARIO_PLAYBACK) */
 
-/* LED toggle delay. This delay is applicable/true in POWER_MODE_HP only.
- * This is because, SystemCoreClock variable is not updated when the power mode
- * is changes. This is intentional to show that the core frequency is indeed
- * getting changed as a result of successful power mode switch. */
-#define BLINKY_LED_DELAY_MSEC (500U)
+    if (0 == strcmp(argv[1], "auto"))
+    {
+        governor_paused = false;
+        perf_vote_set(&perf_votes, &governor_client, governor.level);
+        perf_vote_release(&perf_votes, &console_client);
+    }
+    else if ((0 == strcmp(argv[1], "dsoff")) || (0 == strcmp(argv[1], "hibernate")))
+    {
+        cy_stc_user_syspm_ds_cfg_t config =
+        {
+            .sram_retain_mask = 0UL,
+            .socmem_retain = 0UL,
+            .wakeup_src = DEEP_OFF_WAKEUP_SRC
+        };
 
-/* The timeout value in microseconds used to wait for CM55 core to be booted */
-#define CM55_BOOT_WAIT_TIME_USEC (10U)
+        /* Nothing drains the transmit buffer in DS-OFF or Hibernate */
+        retarget_io_flush();
 
-/* App boot address for CM55 project */
-#define CM55_APP_BOOT_ADDR (CYMEM_CM33_0_m55_nvm_START + CYBSP_MCUBOOT_HEADER_SIZE)
+        if (0 == strcmp(argv[1], "dsoff"))
+        {
+            (void)Cy_USER_SysEnterDSOff(&config);
+        }
+        else
+        {
+            (void)Cy_USER_SysEnterHibernate(&config);
+        }
 
-/* USER BTN1 interrupt priority */
-#define BTN_IRQ_PRIORITY (7U)
+        /* Returning here means the entry failed */
+        return CONSOLE_STATUS_FAILED;
+    }
+    else
+    {
+        dvfs_level_t level;
+
+        if (0 == strcmp(argv[1], "hp"))
+        {
+            level = DVFS_LEVEL_HP;
+        }
+        else if (0 == strcmp(argv[1], "lp"))
+        {
+            level = DVFS_LEVEL_LP;
+        }
+        else if (0 == strcmp(argv[1], "ulp"))
+        {
+            level = DVFS_LEVEL_ULP;
+        }
+        else
+        {
+            return CONSOLE_STATUS_BAD_ARGS;
+        }
+
+        governor_paused = true;
+        perf_vote_set(&perf_votes, &console_client, level);
+        perf_vote_release(&perf_votes, &governor_client);
+    }
+
+    (void)console_put_u32(rsp, &pos, *len, (uint32_t)perf_votes.level);
+    *len = pos;
+
+    return CONSOLE_STATUS_OK;
+}
 
-/* Helper macro to wait for completion of UART transmission */
-#define WAIT_FOR_TX_COMPLETE() while (!(Cy_SCB_UART_IsTxComplete(CYBSP_DEBUG_UART_HW)))
 
-/* Power Modes */
-typedef enum
+/*******************************************************************************
+* Function Name: console_cmd_counters
+********************************************************************************
+* Summary:
+*  Console command "counters". Responds with the uptime in milliseconds, the
+*  CPU clock frequency, the performance level and its number of changes, the
+*  governor load and its number of changes, the button glitches and dropped
+*  events, the console lines and errors, the dropped received bytes, and the
+*  dropped log bytes and high-water mark of the transmit buffer.
+*
+* Parameters:
+*  argc - number of words
+*  argv - words of the command line
+*  rsp - response data
+*  len - in: size of rsp, out: response data length
+*
+* Return:
+*  console_status_t - command status
+*
+*******************************************************************************/
+static console_status_t console_cmd_counters(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len)
 {
-    POWER_MODE_HP = 0U,
-    POWER_MODE_LP,
-    POWER_MODE_ULP,
-    POWER_MODE_DS,
-    POWER_MODE_MAX
-} en_power_mode_t;
+    uint32_t pos = 0UL;
+    const uint32_t values[] =
+    {
+        timebase_ms(),
+        SystemCoreClock,
+        (uint32_t)perf_votes.level,
+        perf_votes.changes,
+        governor.load_pct,
+        governor.changes,
+        btn_debounce.glitches,
+        btn_debounce.dropped,
+        app_console.lines,
+        app_console.errors,
+        retarget_io_rx_dropped(),
+        retarget_io_tx_ring()->dropped,
+        retarget_io_tx_ring()->high_water
+    };
+
+    CY_UNUSED_PARAMETER(argv);
+
+    if (1UL != argc)
+    {
+        return CONSOLE_STATUS_BAD_ARGS;
+    }
+
+    for (uint32_t i = 0UL; i < (sizeof(values) / sizeof(values[0])); i++)
+    {
+        if (!console_put_u32(rsp, &pos, *len, values[i]))
+        {
+            return CONSOLE_STATUS_OVERFLOW;
+        }
+    }
+    *len = pos;
+
+    return CONSOLE_STATUS_OK;
+}
+
 
 /*******************************************************************************
-* Global Variables
+* Function Name: console_cmd_park
+********************************************************************************
+* Summary:
+*  Console command "park", same as a press on BTN1. Responds with 1 when the
+*  application is parked, 0 when it runs again. The device only enters Deep
+*  Sleep once the console was quiet for CONSOLE_AWAKE_MSEC.
+*
+* Parameters:
+*  argc - number of words
+*  argv - words of the command line
+*  rsp - response data
+*  len - in: size of rsp, out: response data length
+*
+* Return:
+*  console_status_t - command status
+*
 *******************************************************************************/
+static console_status_t console_cmd_park(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len)
+{
+    uint32_t pos = 0UL;
 
-static volatile bool user_btn_flag = false;
+    CY_UNUSED_PARAMETER(argv);
 
-/*****************************************************************************
-* Function Definitions
-*****************************************************************************/
+    if (1UL != argc)
+    {
+        return CONSOLE_STATUS_BAD_ARGS;
+    }
 
-/********************************************************************************
- * Function Name: check_status
- ********************************************************************************
- * Summary:
- *  Checks for non-zero status, and prints success/error message accordingly.
- *  Indicates the non-zero status by turning the LED1 on, and asserts the
- *  non-zero status.
- *
- * Parameters:
- *  status - status for evaluation.
- *
- * Return:
- *  void
- *
- *******************************************************************************/
-void check_status(cy_rslt_t status)
+#if defined(SCENARIO_PLAYBACK)
+    if (scenario_run_active())
+    {
+        return CONSOLE_STATUS_BUSY;
+    }
+#endif /* defined(SCENARIO_PLAYBACK) */
+
+    toggle_parked();
+
+    (void)console_put_u32(rsp, &pos, *len, app_parked ? 1UL : 0UL);
+    *len = pos;
+
+    return CONSOLE_STATUS_OK;
+}
+
+
+/*******************************************************************************
+* Function Name: console_cmd_residency
+********************************************************************************
+* Summary:
+*  Console command "residency [clear]". Responds with the time spent in HP, LP,
+*  ULP and Deep Sleep in milliseconds, the number of entries into each of them,
+*  the number of failed transitions, the estimated charge in microampere-hours,
+*  the average current in microamperes and the number of intervals discarded
+*  after an LPTimer reset, as kept by the secure side since the counters were
+*  last cleared. "clear" clears them after reading.
+*
+* Parameters:
+*  argc - number of words
+*  argv - words of the command line
+*  rsp - response data
+*  len - in: size of rsp, out: response data length
+*
+* Return:
+*  console_status_t - command status
+*
+*******************************************************************************/
+static console_status_t console_cmd_residency(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len)
 {
-    if (CY_RSLT_SUCCESS != status)
+    uint32_t pos = 0UL;
+    uint64_t total_us = 0ULL;
+    bool clear = false;
+    cy_stc_user_syspm_residency_t residency;
+    uint32_t values[(2UL * CY_USER_SYSPM_RESIDENCY_STATES) + 4UL];
+    uint32_t count = 0UL;
+
+    if ((2UL == argc) && (0 == strcmp(argv[1], "clear")))
     {
-        /* Print Error message */
-        printf(" Status: FAILED [%u]\r\n", (unsigned int)status);
-        printf("==========================================================\r\n");
+        clear = true;
+    }
+    else if (1UL != argc)
+    {
+        return CONSOLE_STATUS_BAD_ARGS;
+    }
 
-        /* Turn on the LED1*/
-        Cy_GPIO_Set(CYBSP_USER_LED1_PORT, CYBSP_USER_LED1_PIN);
-        handle_app_error();
+    if (CY_USER_SYSPM_SUCCESS != Cy_USER_SysGetResidency(&residency, clear))
+    {
+        return CONSOLE_STATUS_FAILED;
+    }
+
+    for (uint32_t state = 0UL; state < CY_USER_SYSPM_RESIDENCY_STATES; state++)
+    {
+        total_us += residency.residency_us[state];
+        values[count++] = (uint32_t)(residency.residency_us[state] / 1000ULL);
+    }
+    for (uint32_t state = 0UL; state < CY_USER_SYSPM_RESIDENCY_STATES; state++)
+    {
+        values[count++] = residency.entries[state];
+    }
+    values[count++] = residency.failures;
+    values[count++] = (uint32_t)(residency.charge_uc / 3600ULL);
+    /* uC / s gives uA */
+    values[count++] = (0ULL != total_us) ? (uint32_t)((residency.charge_uc * 1000000ULL) / total_us) : 0UL;
+    values[count++] = residency.discarded;
+
+    for (uint32_t i = 0UL; i < count; i++)
+    {
+        if (!console_put_u32(rsp, &pos, *len, values[i]))
+        {
+            return CONSOLE_STATUS_OVERFLOW;
+        }
+    }
+    *len = pos;
+
+    return CONSOLE_STATUS_OK;
+}
+
+
+/*******************************************************************************
+* Function Name: console_cmd_state
+********************************************************************************
+* Summary:
+*  Console command "state". Responds with the power and clock state read by
+*  the secure side in one request: the power mode, the CM33 clock, the CLKHF0
+*  divider and frequency, the DPLL frequency, the RRAM voltage mode, the Deep
+*  Sleep depth of the system, application and SOCMEM domains, and whether the
+*  Secure Enclave is enabled.
+*
+* Parameters:
+*  argc - number of words
+*  argv - words of the command line
+*  rsp - response data
+*  len - in: size of rsp, out: response data length
+*
+* Return:
+*  console_status_t - command status
+*
+*******************************************************************************/
+static console_status_t console_cmd_state(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len)
+{
+    uint32_t pos = 0UL;
+    cy_stc_user_syspm_state_t state;
+
+    CY_UNUSED_PARAMETER(argv);
+
+    if (1UL != argc)
+    {
+        return CONSOLE_STATUS_BAD_ARGS;
+    }
+
+    if (CY_USER_SYSPM_SUCCESS != Cy_USER_SysGetState(&state))
+    {
+        return CONSOLE_STATUS_FAILED;
+    }
+
+    const uint32_t values[] =
+    {
+        state.mode,
+        state.core_hz,
+        state.clkhf0_div,
+        state.clkhf0_hz,
+        state.dpll_hz,
+        state.rram_vmode,
+        state.ds_modes.sys_mode,
+        state.ds_modes.app_mode,
+        state.ds_modes.socmem_mode,
+        state.se_enabled
+    };
+
+    for (uint32_t i = 0UL; i < (sizeof(values) / sizeof(values[0])); i++)
+    {
+        if (!console_put_u32(rsp, &pos, *len, values[i]))
+        {
+            return CONSOLE_STATUS_OVERFLOW;
+        }
+    }
+    *len = pos;
+
+    return CONSOLE_STATUS_OK;
+}
+
+
+/*******************************************************************************
+* Function Name: console_cmd_cm55
+********************************************************************************
+* Summary:
+*  Console command "cm55 off|on". "off" withdraws the CM55 vote, powers off
+*  the CM55 and its application domain and clears the job ring. "on" restarts
+*  the CM55 from its boot image and responds with the restart latency in
+*  microseconds and 1 if the image was validated by this request, 0 if the
+*  cached result was used. "on" is refused while the CM55 runs.
+*
+* Parameters:
+*  argc - number of words
+*  argv - words of the command line
+*  rsp - response data
+*  len - in: size of rsp, out: response data length
+*
+* Return:
+*  console_status_t - command status
+*
+*******************************************************************************/
+static console_status_t console_cmd_cm55(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len)
+{
+    uint32_t pos = 0UL;
+    cy_stc_user_syspm_cm55_restart_t restart;
+
+    if (2UL != argc)
+    {
+        return CONSOLE_STATUS_BAD_ARGS;
+    }
+
+#if defined(SCENARIO_PLAYBACK)
+    if (scenario_run_active())
+    {
+        return CONSOLE_STATUS_BUSY;
+    }
+#endif /* defined(SCENARIO_PLAYBACK) */
+
+    if (0 == strcmp(argv[1], "off"))
+    {
+        if (!cm55_off && !cm55_power_off())
+        {
+            return CONSOLE_STATUS_FAILED;
+        }
+        *len = 0UL;
+    }
+    else if (0 == strcmp(argv[1], "on"))
+    {
+        if (!cm55_off)
+        {
+            return CONSOLE_STATUS_BUSY;
+        }
+        if (!cm55_power_on(&restart))
+        {
+            return CONSOLE_STATUS_FAILED;
+        }
+
+        (void)console_put_u32(rsp, &pos, *len, restart.restart_us);
+        (void)console_put_u32(rsp, &pos, *len, restart.validated);
+        *len = pos;
     }
     else
     {
-        /* Print Success message */
-        printf(" Status: SUCCESS\r\n");
+        return CONSOLE_STATUS_BAD_ARGS;
     }
+
+    return CONSOLE_STATUS_OK;
+}
+
+
+#if defined(SCENARIO_PLAYBACK)
+/*******************************************************************************
+* Function Name: console_cmd_scenario
+********************************************************************************
+* Summary:
+*  Console command "scenario". Runs the scenario again, the application timers
+*  are stopped meanwhile. An event frame is sent when it is done.
+*
+* Parameters:
+*  argc - number of words
+*  argv - words of the command line
+*  rsp - response data
+*  len - in: size of rsp, out: response data length
+*
+* Return:
+*  console_status_t - command status
+*
+*******************************************************************************/
+static console_status_t console_cmd_scenario(uint32_t argc, char* const* argv, uint8_t* rsp, uint32_t* len)
+{
+    CY_UNUSED_PARAMETER(argv);
+    CY_UNUSED_PARAMETER(rsp);
+
+    if (1UL != argc)
+    {
+        return CONSOLE_STATUS_BAD_ARGS;
+    }
+
+    /* The timers are restarted when the scenario is done */
+    if (scenario_run_active() || app_parked)
+    {
+        return CONSOLE_STATUS_BUSY;
+    }
+
+    event_sched_timer_stop(&app_sched, &led_timer);
+    event_sched_timer_stop(&app_sched, &governor_timer);
+#if defined(CM55_OFFLOAD_DEMO)
+    cm55_offload_stop();
+#endif /* defined(CM55_OFFLOAD_DEMO) */
+
+    scenario_run_start(&app_sched, scenario_done);
+    *len = 0UL;
+
+    return CONSOLE_STATUS_OK;
 }
+#endif /* defined(SCENARIO_PLAYBACK) */
 
 
 /*******************************************************************************
@@ -128,8 +1572,8 @@ void check_status(cy_rslt_t status)
 ********************************************************************************
 * Summary:
 *  Interrupt serive routine for CYBSP_USER_BTN1_PORT and .
-*  This function checks which user button was presssed and sets the
-*  button_status flag.
+*  This function checks which user button had an edge and reports it to the
+*  debounce service, which confirms the new level from a timer.
 *
 * Parameter:
 *  void
@@ -140,13 +1584,10 @@ void check_status(cy_rslt_t status)
 *******************************************************************************/
 void gpio_isr_handler(void)
 {
-    /* Delay to handle de-bouncing  */
-    Cy_SysLib_Delay(200);
-
-    /* Check if USER_BTN1 was pressed */
+    /* Check if USER_BTN1 had an edge */
     if(1UL == Cy_GPIO_GetInterruptStatus(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN))
     {
-        user_btn_flag = true;
+        debounce_edge(&btn1_input);
 
         /* Clear the USER_BTN1 interrupt */
         Cy_GPIO_ClearInterrupt(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN);
@@ -175,8 +1616,17 @@ void gpio_isr_handler(void)
 * retarget-io middleware to be used with the debug UART port using which
 * messages are printed on the debug UART. The LED1 pin is initialized with
 * default configurations. The CM55 core is enabled and then the programs enters
-* an infinite while loop which toggles the LED1 and waits for BTN1 interrupt to
-* change the Power mode of the device.
+* the event scheduler loop. The scheduler toggles the LED1 and runs the governor
+* from LPTimer-based timers and puts the CPU into Sleep or Deep Sleep between
+* them. The power mode is the highest level voted for by the governor, which
+* follows the CPU load, and by the CM55 through its mailbox. A press on BTN1
+* stops the timers, leaving the device in Deep Sleep until the next press.
+* Commands received on the debug UART are answered with binary frames by the
+* console.
+*
+* After a wake-up from DS-OFF or Hibernate with a valid warm-boot record, the
+* start-up messages and the CM55 boot wait are skipped and the saved power mode
+* is resumed before entering the loop.
 *
 * Parameters:
 *  none
@@ -188,9 +1638,10 @@ void gpio_isr_handler(void)
 int main(void)
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
-    uint32_t loop_cnt = 0;
-    en_power_mode_t cur_pwr_mode = POWER_MODE_HP;
-    en_power_mode_t nxt_pwr_mode = POWER_MODE_LP;
+    dvfs_level_t level = DVFS_LEVEL_HP;
+    uint32_t warm_ctx[WARM_BOOT_CONTEXT_WORDS] = {0UL};
+    uint32_t preserved;
+    cy_stc_user_syspm_cm55_restart_t cm55_restart = {0UL, 0UL};
 
     /* Interrupt config structure */
     cy_stc_sysint_t gpio_int_config =
@@ -199,6 +1650,10 @@ int main(void)
         .intrPriority = BTN_IRQ_PRIORITY
     };
 
+    /* The warm-boot record is read through the SRF, the path is known once the
+     * pool is up */
+    warm_boot_timing_start(&warm_boot_timing, false, cpu_cycles());
+
     /* Initialize the device and board peripherals. */
     result = cybsp_init();
 
@@ -207,6 +1662,10 @@ int main(void)
     {
         handle_app_error();
     }
+    warm_boot_timing_mark(&warm_boot_timing, WARM_BOOT_PHASE_BSP, cpu_cycles());
+
+    /* Start the non-secure event trace, a no-op unless TRACE_TIMELINE is set */
+    TRACE_INIT();
 
     /* Initialize SRF user module memory pool */
     cy_user_srf_module_pool_init();
@@ -215,14 +1674,45 @@ int main(void)
         handle_app_error();
     }
 
+    /* Publish the power state to shared memory, so reading it needs no request */
+    if (CY_USER_SYSPM_SUCCESS != Cy_USER_SysTelemetryInit())
+    {
+        handle_app_error();
+    }
+
+    /* Consume the warm-boot record, an invalid record selects the cold path */
+    warm_boot_load();
+    preserved = warm_boot_resume(&warm_boot_record, warm_boot_image_id(WARM_BOOT_BUILD_STR), warm_ctx);
+    warm_boot_store();
+    warm_boot_timing.warm = (0UL != preserved);
+
+    warm_boot_timing_mark(&warm_boot_timing, WARM_BOOT_PHASE_SRF, cpu_cycles());
+
     /* Enable global interrupts */
     __enable_irq();
 
     /* Initialize retarget-io middleware */
     init_retarget_io();
+    log_token_init(retarget_io_log);
+    warm_boot_timing_mark(&warm_boot_timing, WARM_BOOT_PHASE_RETARGET_IO, cpu_cycles());
+
+    /* Initialize the register snapshot used across Deep Sleep RAM */
+    init_reg_snapshot();
 
-    /* Enable CM55. */
-    Cy_SysEnableCM55(MXCM55, CM55_APP_BOOT_ADDR, CY_SYS_CORE_WAIT_INFINITE);
+    /* Arm the warm-boot record before DS-OFF and Hibernate */
+    Cy_SysPm_RegisterCallback(&warm_boot_ds_off_syspm_cb);
+    Cy_SysPm_RegisterCallback(&warm_boot_hibernate_syspm_cb);
+
+    /* The button events are posted from the ISR, so register them first */
+    event_sched_init(&app_sched, &event_sched_lptimer_port);
+    event_sched_on(&app_sched, APP_EVENT_BUTTON, button_event_cb, NULL);
+    event_sched_on(&app_sched, APP_EVENT_CM55, cm55_event_cb, NULL);
+    debounce_init(&btn_debounce, &app_sched, APP_EVENT_BTN_EDGE, APP_EVENT_BUTTON);
+    if (!debounce_add(&btn_debounce, &btn1_input, CYBSP_USER_BTN1_PIN, btn1_read,
+                      EVENT_SCHED_MS_TO_TICKS(BTN_DEBOUNCE_MSEC)))
+    {
+        handle_app_error();
+    }
 
     /* Configure USER_BTN1 interrupt */
     /* CYBSP_USER_BTN1 (SW2) and CYBSP_USER_BTN2 (SW4) share the same port in the
@@ -235,108 +1725,104 @@ int main(void)
     Cy_GPIO_ClearInterrupt(CYBSP_USER_BTN2_PORT, CYBSP_USER_BTN2_PIN);
     NVIC_ClearPendingIRQ(CYBSP_USER_BTN2_IRQ);
 #endif
+
+    /* Releases are debounced as well, so interrupt on both edges */
+    Cy_GPIO_SetInterruptEdge(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN, CY_GPIO_INTR_BOTH);
     Cy_GPIO_ClearInterrupt(CYBSP_USER_BTN1_PORT, CYBSP_USER_BTN1_PIN);
     NVIC_ClearPendingIRQ(CYBSP_USER_BTN1_IRQ);
     Cy_SysInt_Init(&gpio_int_config, gpio_isr_handler);
-    NVIC_EnableIRQ(gpio_int_config.intrSrc);
 
-    /* \x1b[2J\x1b[;H - ANSI ESC sequence for clear screen. */
-    printf("\x1b[2J\x1b[;H");
+    /* Clear the CM55 vote and the job ring before it boots, it rings the
+     * doorbell on a vote change and after running jobs */
+    IPC_SHARED->cm55_vote.level = IPC_VOTE_NONE;
+    ipc_shared_publish(&IPC_SHARED->cm55_vote, sizeof(IPC_SHARED->cm55_vote));
+    job_ring_init(&IPC_SHARED->jobs, ipc_shared_publish);
+    ipc_doorbell_init(IPC_DOORBELL_CM33, CM55_DOORBELL_IRQ_PRIORITY, cm55_doorbell_isr);
+    warm_boot_timing_mark(&warm_boot_timing, WARM_BOOT_PHASE_APP, cpu_cycles());
 
-    printf("****************** "
-           "PSOC Edge MCU: Secure Power Management"
-           " ******************\r\n\n");
-
-    printf(" Device is currently in High Performance Mode\r\n\n");
-    printf(" Press USER BTN1 to change the Power Mode\r\n\n");
-
-    for(;;)
+    /* Enable CM55 through the secure side, which validates its boot image. On a
+     * warm boot the image was already booted once, so do not block on it. */
+    if (CY_USER_SYSPM_SUCCESS != Cy_USER_SysCm55PowerOn((0UL != (preserved & (1UL << WARM_BOOT_PHASE_CM55))) ?
+                                                        CM55_BOOT_WAIT_TIME_USEC : CY_SYS_CORE_WAIT_INFINITE,
+                                                        &cm55_restart))
     {
-        /* Check and update the power mode */
-        if (user_btn_flag)
-        {
-            printf("==========================================================\r\n");
-
-            switch (nxt_pwr_mode)
-            {
-                case POWER_MODE_HP:
-                {
-                    printf(" Switching to High Performance mode\r\n");
-                    WAIT_FOR_TX_COMPLETE();
-
-                    result = (cy_rslt_t)Cy_USER_SysEnterHp();
-                    check_status(result);
-
-                    nxt_pwr_mode = POWER_MODE_LP;
-                    cur_pwr_mode = POWER_MODE_HP;
-                }
-                break;
+        handle_app_error();
+    }
+    warm_boot_timing_mark(&warm_boot_timing, WARM_BOOT_PHASE_CM55, cpu_cycles());
 
-                case POWER_MODE_LP:
-                {
-                    printf(" Switching to Low Power mode\r\n");
-                    WAIT_FOR_TX_COMPLETE();
+    if (0UL == (preserved & (1UL << WARM_BOOT_PHASE_BANNER)))
+    {
+        /* \x1b[2J\x1b[;H - ANSI ESC sequence for clear screen. */
+        printf("\x1b[2J\x1b[;H");
 
-                    result = (cy_rslt_t)Cy_USER_SysEnterLp();
-                    check_status(result);
+        printf("****************** "
+               "PSOC Edge MCU: Secure Power Management"
+               " ******************\r\n\n");
 
-                    nxt_pwr_mode = (cur_pwr_mode == POWER_MODE_HP) ? POWER_MODE_ULP : POWER_MODE_HP;
-                    cur_pwr_mode = POWER_MODE_LP;
-                }
-                break;
+        printf(" The Power Mode follows the CPU load (%s governor)\r\n\n", GOVERNOR_POLICY->name);
+        printf(" Press USER BTN1 to enter Deep Sleep mode, press again to wake up\r\n\n");
+    }
+    warm_boot_timing_mark(&warm_boot_timing, WARM_BOOT_PHASE_BANNER, cpu_cycles());
 
-                case POWER_MODE_ULP:
-                {
-                    printf(" Switching to Ultra Low Power mode\r\n");
-                    WAIT_FOR_TX_COMPLETE();
+    print_boot_timing();
+    log_token(LOG_TOKEN_CM55_ON, cm55_restart.restart_us, cm55_restart.validated);
 
-                    result = (cy_rslt_t)Cy_USER_SysEnterUlp();
-                    check_status(result);
+    /* Starts the LPTimer. The latency benchmark borrows it, and button edges
+     * are timestamped with it, so enable the button after. */
+    event_sched_port_init();
 
-                    nxt_pwr_mode = POWER_MODE_DS;
-                    cur_pwr_mode = POWER_MODE_ULP;
-                }
-                break;
+#if defined(LATENCY_BENCHMARK)
+    /* Runs in HP and returns to HP before the power mode is resumed */
+    latency_bench_run();
+#endif /* defined(LATENCY_BENCHMARK) */
 
-                case POWER_MODE_DS:
-                {
-                    printf(" Entering Deep Sleep mode \r\n\n");
-                    WAIT_FOR_TX_COMPLETE();
+#if defined(THROUGHPUT_BENCHMARK)
+    /* Runs in HP and returns to HP, like the latency benchmark */
+    throughput_bench_run();
+#endif /* defined(THROUGHPUT_BENCHMARK) */
 
-                    Cy_GPIO_Clr(CYBSP_USER_LED1_PORT, CYBSP_USER_LED1_PIN);
+    NVIC_EnableIRQ(gpio_int_config.intrSrc);
 
-                    result = (cy_rslt_t)Cy_USER_SysEnterDS();
-                    check_status(result);
+    /* The secure side accounts residency with the LPTimer. Drop what the
+     * benchmarks accounted, the application counts from here on. */
+    (void)Cy_USER_SysGetResidency(NULL, true);
 
-                    /* Device will be back in ULP on successful entry and exit from Deep sleep mode */
-                    printf(" Wakeup from Deep Sleep mode, back in Ultra Low Power mode\r\n");
-                    nxt_pwr_mode = POWER_MODE_LP;
-                    cur_pwr_mode = POWER_MODE_ULP;
-                }
-                break;
+    /* Bytes received before this point are taken by the first event */
+    console_init(&app_console, console_cmds, sizeof(console_cmds) / sizeof(console_cmds[0]), retarget_io_write);
+    event_sched_on(&app_sched, APP_EVENT_CONSOLE, console_event_cb, NULL);
+    retarget_io_set_rx_notify(console_rx_notify);
+    event_sched_post(&app_sched, APP_EVENT_CONSOLE);
 
-                default:
-                {
-                    printf(" Error: Invalid Power Mode \r\n\n");
-                    CY_ASSERT(0);
-                }
-                break;
-            }
+    if (0UL != preserved)
+    {
+        level = (dvfs_level_t)warm_ctx[WARM_BOOT_CTX_PWR_LEVEL];
+        set_power_level(DVFS_LEVEL_HP, level);
+    }
 
-            printf("==========================================================\r\n");
+    dvfs_governor_init(&governor, GOVERNOR_POLICY, &governor_cfg, level, timebase_ms());
 
-            user_btn_flag = false;
-        }
+    /* All votes are cast from the scheduler loop, so no lock is needed */
+    perf_vote_init(&perf_votes, DVFS_LEVEL_ULP, level, apply_perf_level, NULL, NULL, NULL);
+    /* Logged by their registration order, see VOTE_HOLDERS in tools/log_decode.py */
+    perf_vote_register(&perf_votes, &governor_client, "governor");
+    perf_vote_register(&perf_votes, &cm55_client, "CM55");
+    perf_vote_register(&perf_votes, &console_client, "console");
+    perf_vote_set(&perf_votes, &governor_client, level);
 
-        /* Check and toggle the LED */
-        if (loop_cnt == BLINKY_LED_DELAY_MSEC)
-        {
-            loop_cnt = 0;
-            Cy_GPIO_Inv(CYBSP_USER_LED1_PORT, CYBSP_USER_LED1_PIN);
-        }
+    event_sched_take_load(&app_sched, NULL, NULL);
+#if defined(CM55_OFFLOAD_DEMO)
+    cm55_offload_init(&app_sched);
+#endif /* defined(CM55_OFFLOAD_DEMO) */
+#if defined(SCENARIO_PLAYBACK)
+    /* The governor takes over the power mode once the scenario is done */
+    scenario_run_start(&app_sched, scenario_done);
+#else
+    start_app_timers();
+#endif /* defined(SCENARIO_PLAYBACK) */
 
-        loop_cnt++;
-        Cy_SysLib_Delay(1U);
+    for(;;)
+    {
+        event_sched_run_once(&app_sched);
     }
 }
 
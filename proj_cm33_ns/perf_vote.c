@@ -0,0 +1,279 @@
+/*******************************************************************************
+ * File Name:   perf_vote.c
+ *
+ * Description: This file contains the performance level vote aggregator.
+ *              Every client votes for the minimum level it needs, and the
+ *              system runs at the highest level voted for. The level is only
+ *              changed when that maximum changes, and the client holding it
+ *              is tracked for reporting.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "perf_vote.h"
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: update
+********************************************************************************
+* Summary:
+* Recomputes the aggregate level and applies it if it changed. The first
+* registered client wins a tie, so the holder does not flip between clients
+* voting for the same level.
+*
+* Parameters:
+*  pv - aggregator
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void update(perf_vote_t* pv)
+{
+    dvfs_level_t level = pv->floor;
+    perf_vote_client_t* holder = NULL;
+
+    for (perf_vote_client_t* client = pv->clients; NULL != client; client = client->next)
+    {
+        if (client->voting && (client->level > level))
+        {
+            level = client->level;
+            holder = client;
+        }
+    }
+
+    pv->holder = holder;
+
+    if (level != pv->level)
+    {
+        dvfs_level_t from = pv->level;
+
+        if ((level > from) && (NULL != holder))
+        {
+            holder->raises++;
+        }
+
+        pv->level = level;
+        pv->changes++;
+        pv->apply(from, level, pv->apply_arg);
+    }
+}
+
+/*******************************************************************************
+* Function Name: perf_vote_init
+********************************************************************************
+* Summary:
+* Initializes the aggregator.
+*
+* Parameters:
+*  pv - aggregator
+*  floor - level used when no client votes above it
+*  level - level the system runs at
+*  apply - moves the system from one level to another
+*  apply_arg - argument of apply
+*  lock - serializes the voters if they run in different threads, can be NULL
+*  unlock - releases lock, can be NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_vote_init(perf_vote_t* pv, dvfs_level_t floor, dvfs_level_t level,
+                    perf_vote_apply_t apply, void* apply_arg,
+                    void (*lock)(void), void (*unlock)(void))
+{
+    pv->clients = NULL;
+    pv->floor = floor;
+    pv->level = level;
+    pv->holder = NULL;
+    pv->changes = 0UL;
+    pv->apply = apply;
+    pv->apply_arg = apply_arg;
+    pv->lock = lock;
+    pv->unlock = unlock;
+}
+
+/*******************************************************************************
+* Function Name: perf_vote_register
+********************************************************************************
+* Summary:
+* Adds a client. The client does not vote until perf_vote_set() is called.
+*
+* Parameters:
+*  pv - aggregator
+*  client - client, must stay valid while registered
+*  name - client name used in reports
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_vote_register(perf_vote_t* pv, perf_vote_client_t* client, const char* name)
+{
+    perf_vote_client_t** tail = &pv->clients;
+
+    client->name = name;
+    client->level = pv->floor;
+    client->voting = false;
+    client->raises = 0UL;
+    client->id = 1UL;
+    client->next = NULL;
+
+    if (NULL != pv->lock)
+    {
+        pv->lock();
+    }
+
+    while (NULL != *tail)
+    {
+        tail = &(*tail)->next;
+        client->id++;
+    }
+    *tail = client;
+
+    if (NULL != pv->unlock)
+    {
+        pv->unlock();
+    }
+}
+
+/*******************************************************************************
+* Function Name: perf_vote_set
+********************************************************************************
+* Summary:
+* Sets the minimum level a client needs. The system level changes only if the
+* highest vote changes.
+*
+* Parameters:
+*  pv - aggregator
+*  client - client
+*  level - minimum level
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_vote_set(perf_vote_t* pv, perf_vote_client_t* client, dvfs_level_t level)
+{
+    if (NULL != pv->lock)
+    {
+        pv->lock();
+    }
+
+    client->level = level;
+    client->voting = true;
+    update(pv);
+
+    if (NULL != pv->unlock)
+    {
+        pv->unlock();
+    }
+}
+
+/*******************************************************************************
+* Function Name: perf_vote_release
+********************************************************************************
+* Summary:
+* Withdraws the vote of a client.
+*
+* Parameters:
+*  pv - aggregator
+*  client - client
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_vote_release(perf_vote_t* pv, perf_vote_client_t* client)
+{
+    if (NULL != pv->lock)
+    {
+        pv->lock();
+    }
+
+    client->voting = false;
+    update(pv);
+
+    if (NULL != pv->unlock)
+    {
+        pv->unlock();
+    }
+}
+
+/*******************************************************************************
+* Function Name: perf_vote_holder_name
+********************************************************************************
+* Summary:
+* Returns the name of the client holding the system at its level.
+*
+* Parameters:
+*  pv - aggregator
+*
+* Return:
+*  const char* - client name, "none" at the floor level
+*
+*******************************************************************************/
+const char* perf_vote_holder_name(const perf_vote_t* pv)
+{
+    const perf_vote_client_t* holder = pv->holder;
+
+    return (NULL != holder) ? holder->name : "none";
+}
+
+/*******************************************************************************
+* Function Name: perf_vote_holder_id
+********************************************************************************
+* Summary:
+* Returns the registration order of the client holding the system at its
+* level, so that the holder can be logged without its name.
+*
+* Parameters:
+*  pv - aggregator
+*
+* Return:
+*  uint32_t - 1 for the first client registered, 0 at the floor level
+*
+*******************************************************************************/
+uint32_t perf_vote_holder_id(const perf_vote_t* pv)
+{
+    const perf_vote_client_t* holder = pv->holder;
+
+    return (NULL != holder) ? holder->id : 0UL;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * File Name:   perf_vote.h
+ *
+ * Description: This file is the public interface of perf_vote.c, the
+ *              performance level vote aggregator.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _PERF_VOTE_H_
+#define _PERF_VOTE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The aggregator only depends on the C library so it can be built on the host */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dvfs_governor.h"
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Applies a new aggregate level, called with the aggregator lock held */
+typedef void (*perf_vote_apply_t)(dvfs_level_t from, dvfs_level_t to, void* arg);
+
+/* Vote client */
+typedef struct perf_vote_client
+{
+    const char*                 name;
+    dvfs_level_t                level;      /* Minimum level requested */
+    bool                        voting;     /* false once the vote was released */
+    uint32_t                    raises;     /* Times the client raised the aggregate */
+    uint32_t                    id;         /* Registration order from 1, set by the aggregator */
+    struct perf_vote_client*    next;       /* Set by the aggregator */
+} perf_vote_client_t;
+
+/* Aggregator state */
+typedef struct
+{
+    perf_vote_client_t*         clients;
+    dvfs_level_t                floor;      /* Level used when nobody votes */
+    dvfs_level_t                level;      /* Current aggregate level */
+    const perf_vote_client_t*   holder;     /* Client the level is held for, NULL at the floor */
+    uint32_t                    changes;    /* Number of aggregate changes */
+    perf_vote_apply_t           apply;
+    void*                       apply_arg;
+    void                        (*lock)(void);      /* Serializes the voters, can be NULL */
+    void                        (*unlock)(void);
+} perf_vote_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void perf_vote_init(perf_vote_t* pv, dvfs_level_t floor, dvfs_level_t level,
+                    perf_vote_apply_t apply, void* apply_arg,
+                    void (*lock)(void), void (*unlock)(void));
+void perf_vote_register(perf_vote_t* pv, perf_vote_client_t* client, const char* name);
+void perf_vote_set(perf_vote_t* pv, perf_vote_client_t* client, dvfs_level_t level);
+void perf_vote_release(perf_vote_t* pv, perf_vote_client_t* client);
+const char* perf_vote_holder_name(const perf_vote_t* pv);
+uint32_t perf_vote_holder_id(const perf_vote_t* pv);
+
+#endif /* _PERF_VOTE_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,254 @@
+/*******************************************************************************
+ * File Name:   reg_snapshot.c
+ *
+ * Description: This file contains the peripheral register snapshot engine.
+ *              Peripherals register descriptors of the registers that must
+ *              survive a deep power state. Before entry, the engine saves them
+ *              into retained storage in one pass, and after wake-up restores
+ *              them in one pass.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "reg_snapshot.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Storage layout: magic, number of data words, checksum, data */
+#define HDR_MAGIC       (0U)
+#define HDR_WORDS       (1U)
+#define HDR_CHECKSUM    (2U)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: checksum
+********************************************************************************
+* Summary:
+* Computes a rotate-xor checksum over the snapshot data words.
+*
+* Parameters:
+*  data - first data word
+*  words - number of data words
+*
+* Return:
+*  uint32_t - checksum
+*
+*******************************************************************************/
+static uint32_t checksum(const uint32_t* data, uint32_t words)
+{
+    uint32_t sum = REG_SNAPSHOT_MAGIC;
+
+    for (uint32_t i = 0U; i < words; i++)
+    {
+        sum = ((sum << 1U) | (sum >> 31U)) ^ data[i];
+    }
+
+    return sum;
+}
+
+/*******************************************************************************
+* Function Name: reg_snapshot_init
+********************************************************************************
+* Summary:
+* Initializes the engine with its retained storage. The storage must be placed
+* in memory retained in the deep power states the engine is used for.
+*
+* Parameters:
+*  ctx - engine context
+*  storage - retained storage
+*  storage_words - size of the storage in words
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void reg_snapshot_init(reg_snapshot_t* ctx, uint32_t* storage, uint32_t storage_words)
+{
+    ctx->descs = NULL;
+    ctx->storage = storage;
+    ctx->storage_words = storage_words;
+    ctx->used_words = 0U;
+
+    reg_snapshot_invalidate(ctx);
+}
+
+/*******************************************************************************
+* Function Name: reg_snapshot_register
+********************************************************************************
+* Summary:
+* Adds a peripheral descriptor to the snapshot. Descriptors are saved and
+* restored in registration order.
+*
+* Parameters:
+*  ctx - engine context
+*  desc - peripheral descriptor, must stay valid while registered
+*
+* Return:
+*  bool - false if the registers do not fit in the storage
+*
+*******************************************************************************/
+bool reg_snapshot_register(reg_snapshot_t* ctx, reg_snapshot_desc_t* desc)
+{
+    uint32_t words = 0U;
+    reg_snapshot_desc_t** tail = &ctx->descs;
+
+    for (uint32_t i = 0U; i < desc->num_runs; i++)
+    {
+        words += desc->runs[i].count;
+    }
+
+    if ((ctx->used_words + words + REG_SNAPSHOT_HEADER_WORDS) > ctx->storage_words)
+    {
+        return false;
+    }
+
+    while (NULL != *tail)
+    {
+        tail = &(*tail)->next;
+    }
+
+    desc->next = NULL;
+    *tail = desc;
+    ctx->used_words += words;
+
+    /* A snapshot taken with the previous layout no longer matches */
+    reg_snapshot_invalidate(ctx);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: reg_snapshot_save
+********************************************************************************
+* Summary:
+* Saves all registered registers into the storage and seals the snapshot.
+*
+* Parameters:
+*  ctx - engine context
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void reg_snapshot_save(reg_snapshot_t* ctx)
+{
+    uint32_t* data = &ctx->storage[REG_SNAPSHOT_HEADER_WORDS];
+    uint32_t idx = 0U;
+
+    for (const reg_snapshot_desc_t* desc = ctx->descs; NULL != desc; desc = desc->next)
+    {
+        for (uint32_t run = 0U; run < desc->num_runs; run++)
+        {
+            for (uint32_t reg = 0U; reg < desc->runs[run].count; reg++)
+            {
+                data[idx++] = desc->runs[run].base[reg];
+            }
+        }
+    }
+
+    ctx->storage[HDR_WORDS] = idx;
+    ctx->storage[HDR_CHECKSUM] = checksum(data, idx);
+    ctx->storage[HDR_MAGIC] = REG_SNAPSHOT_MAGIC;
+}
+
+/*******************************************************************************
+* Function Name: reg_snapshot_restore
+********************************************************************************
+* Summary:
+* Writes the saved registers back if the storage holds a valid snapshot of the
+* current layout. The snapshot is consumed.
+*
+* Parameters:
+*  ctx - engine context
+*
+* Return:
+*  bool - false if no valid snapshot was found
+*
+*******************************************************************************/
+bool reg_snapshot_restore(reg_snapshot_t* ctx)
+{
+    const uint32_t* data = &ctx->storage[REG_SNAPSHOT_HEADER_WORDS];
+    uint32_t idx = 0U;
+
+    if ((REG_SNAPSHOT_MAGIC != ctx->storage[HDR_MAGIC]) ||
+        (ctx->used_words != ctx->storage[HDR_WORDS]) ||
+        (checksum(data, ctx->used_words) != ctx->storage[HDR_CHECKSUM]))
+    {
+        return false;
+    }
+
+    for (const reg_snapshot_desc_t* desc = ctx->descs; NULL != desc; desc = desc->next)
+    {
+        for (uint32_t run = 0U; run < desc->num_runs; run++)
+        {
+            for (uint32_t reg = 0U; reg < desc->runs[run].count; reg++)
+            {
+                desc->runs[run].base[reg] = data[idx++];
+            }
+        }
+    }
+
+    reg_snapshot_invalidate(ctx);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: reg_snapshot_invalidate
+********************************************************************************
+* Summary:
+* Discards the snapshot held in the storage.
+*
+* Parameters:
+*  ctx - engine context
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void reg_snapshot_invalidate(reg_snapshot_t* ctx)
+{
+    if (ctx->storage_words >= REG_SNAPSHOT_HEADER_WORDS)
+    {
+        ctx->storage[HDR_MAGIC] = 0UL;
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * File Name:   reg_snapshot.h
+ *
+ * Description: This file is the public interface of reg_snapshot.c, the
+ *              peripheral register snapshot engine used to keep peripheral
+ *              context across deep power states.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _REG_SNAPSHOT_H_
+#define _REG_SNAPSHOT_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The engine only depends on the C library so it can be built on the host */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of storage words used by the snapshot header */
+#define REG_SNAPSHOT_HEADER_WORDS   (3U)
+
+/* Identifies a valid snapshot in the storage */
+#define REG_SNAPSHOT_MAGIC          (0x52534E50UL)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* A run of consecutive 32-bit registers */
+typedef struct
+{
+    volatile uint32_t*  base;       /* First register of the run */
+    uint32_t            count;      /* Number of registers in the run */
+} reg_snapshot_run_t;
+
+/* Registers of one peripheral that must survive a deep power state. Runs are
+ * restored in the listed order, so enable bits should come last. */
+typedef struct reg_snapshot_desc
+{
+    const reg_snapshot_run_t*   runs;   /* Register runs of the peripheral */
+    uint32_t                    num_runs;
+    struct reg_snapshot_desc*   next;   /* Set by the engine */
+} reg_snapshot_desc_t;
+
+/* Snapshot engine context */
+typedef struct
+{
+    reg_snapshot_desc_t*    descs;          /* Registered descriptors */
+    uint32_t*               storage;        /* Retained storage */
+    uint32_t                storage_words;  /* Size of the storage in words */
+    uint32_t                used_words;     /* Registers covered by descs */
+} reg_snapshot_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void reg_snapshot_init(reg_snapshot_t* ctx, uint32_t* storage, uint32_t storage_words);
+bool reg_snapshot_register(reg_snapshot_t* ctx, reg_snapshot_desc_t* desc);
+void reg_snapshot_save(reg_snapshot_t* ctx);
+bool reg_snapshot_restore(reg_snapshot_t* ctx);
+void reg_snapshot_invalidate(reg_snapshot_t* ctx);
+
+#endif /* _REG_SNAPSHOT_H_ */
+
+/* [] END OF FILE */
@@ -40,6 +40,8 @@
 * Header Files
 *******************************************************************************/
 #include "retarget_io_init.h"
+#include "user_syspm_srf.h"
+#include "trace.h"
 
 /*******************************************************************************
 * Global Variables
@@ -90,6 +92,218 @@ static cy_stc_syspm_callback_t retarget_io_syspm_cb =
 };
 #endif /* (CY_CFG_PWR_SYS_IDLE_MODE == CY_CFG_PWR_MODE_DEEPSLEEP) */
 
+/* Received bytes, filled by the receive interrupt */
+static volatile uint8_t debug_uart_rx_buf[DEBUG_UART_RX_BUF_SIZE];
+static volatile uint32_t debug_uart_rx_head = 0UL;
+static volatile uint32_t debug_uart_rx_tail = 0UL;
+static volatile uint32_t debug_uart_rx_dropped = 0UL;
+
+/* Bytes to send, drained by the transmit interrupt */
+static uint8_t debug_uart_tx_buf[DEBUG_UART_TX_BUF_SIZE];
+static log_ring_t debug_uart_tx_ring;
+
+/* Set while a power mode transition changes the UART clock */
+static volatile bool debug_uart_tx_paused = false;
+
+/* Called from the interrupts when bytes were received or the RX pin woke the
+ * device up */
+static void (*debug_uart_rx_notify)(void) = NULL;
+
+static cy_en_user_syspm_status_t retarget_io_notify(cy_en_user_syspm_notify_event_t event,
+                                                    const cy_stc_user_syspm_transition_t* transition,
+                                                    void* arg);
+static void debug_uart_tx_kick(void);
+
+/* Power mode transition notifier for Debug UART, its clock divider changes
+ * with the mode */
+static cy_stc_user_syspm_notifier_t retarget_io_notifier =
+{
+    .handler            = &retarget_io_notify,
+    .arg                = NULL
+};
+
+/*******************************************************************************
+* Function Name: retarget_io_notify
+********************************************************************************
+* Summary:
+* Power mode transition notifier of the debug UART. The clock divider changes
+* with the mode, so the transmit interrupt stops feeding the TX FIFO and the
+* bytes already in it are sent at the old baud rate. At most
+* DEBUG_UART_TX_FIFO_BURST bytes are waited for, the rest of the transmit
+* buffer is sent after the transition.
+*
+* Parameters:
+*  event - transition event
+*  transition - old and new power mode
+*  arg - unused
+*
+* Return:
+*  cy_en_user_syspm_status_t - always CY_USER_SYSPM_SUCCESS
+*
+*******************************************************************************/
+static cy_en_user_syspm_status_t retarget_io_notify(cy_en_user_syspm_notify_event_t event,
+                                                    const cy_stc_user_syspm_transition_t* transition,
+                                                    void* arg)
+{
+    CY_UNUSED_PARAMETER(transition);
+    CY_UNUSED_PARAMETER(arg);
+
+    if (CY_USER_SYSPM_NOTIFY_PREPARE == event)
+    {
+        debug_uart_tx_paused = true;
+        Cy_SCB_SetTxInterruptMask(CYBSP_DEBUG_UART_HW, 0UL);
+
+        while (!Cy_SCB_UART_IsTxComplete(CYBSP_DEBUG_UART_HW))
+        {
+        }
+    }
+    else
+    {
+        debug_uart_tx_paused = false;
+        debug_uart_tx_kick();
+    }
+
+    return CY_USER_SYSPM_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: debug_uart_tx_fill
+********************************************************************************
+* Summary:
+* Moves bytes from the transmit buffer to the TX FIFO, up to
+* DEBUG_UART_TX_FIFO_BURST bytes in the FIFO. Called with the transmit
+* interrupt unable to preempt the caller.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool - true if the transmit buffer still holds bytes
+*
+*******************************************************************************/
+static bool debug_uart_tx_fill(void)
+{
+    uint32_t room = DEBUG_UART_TX_FIFO_BURST - Cy_SCB_UART_GetNumInTxFifo(CYBSP_DEBUG_UART_HW);
+    const uint8_t* data;
+    uint32_t len;
+
+    while ((room > 0UL) && (0UL != (len = log_ring_peek(&debug_uart_tx_ring, &data))))
+    {
+        if (len > room)
+        {
+            len = room;
+        }
+        len = Cy_SCB_UART_PutArray(CYBSP_DEBUG_UART_HW, (void*)data, len);
+        log_ring_consume(&debug_uart_tx_ring, len);
+        room -= len;
+    }
+
+    return (0UL != log_ring_used(&debug_uart_tx_ring));
+}
+
+/*******************************************************************************
+* Function Name: debug_uart_tx_kick
+********************************************************************************
+* Summary:
+* Lets the transmit interrupt drain the transmit buffer, unless a power mode
+* transition is in progress.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void debug_uart_tx_kick(void)
+{
+    if (!debug_uart_tx_paused && (0UL != log_ring_used(&debug_uart_tx_ring)))
+    {
+        Cy_SCB_SetTxInterruptMask(CYBSP_DEBUG_UART_HW, CY_SCB_UART_TX_TRIGGER);
+    }
+}
+
+/*******************************************************************************
+* Function Name: debug_uart_isr
+********************************************************************************
+* Summary:
+* Debug UART interrupt handler. Moves the received bytes from the RX FIFO to
+* the receive buffer, bytes that do not fit are dropped and counted. Tops up
+* the TX FIFO from the transmit buffer, and masks the transmit interrupt once
+* the buffer is empty.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void debug_uart_isr(void)
+{
+    TRACE_ISR_BEGIN();
+
+    while (0UL != Cy_SCB_UART_GetNumInRxFifo(CYBSP_DEBUG_UART_HW))
+    {
+        uint32_t data = Cy_SCB_UART_Get(CYBSP_DEBUG_UART_HW);
+
+        if ((debug_uart_rx_head - debug_uart_rx_tail) < DEBUG_UART_RX_BUF_SIZE)
+        {
+            debug_uart_rx_buf[debug_uart_rx_head & (DEBUG_UART_RX_BUF_SIZE - 1U)] = (uint8_t)data;
+            debug_uart_rx_head++;
+        }
+        else
+        {
+            debug_uart_rx_dropped++;
+        }
+    }
+
+    /* Raised again at once if a byte arrived after the FIFO was emptied */
+    Cy_SCB_ClearRxInterrupt(CYBSP_DEBUG_UART_HW, CY_SCB_RX_INTR_NOT_EMPTY);
+
+    if (0UL != Cy_SCB_GetTxInterruptMask(CYBSP_DEBUG_UART_HW))
+    {
+        if (!debug_uart_tx_fill())
+        {
+            Cy_SCB_SetTxInterruptMask(CYBSP_DEBUG_UART_HW, 0UL);
+        }
+        Cy_SCB_ClearTxInterrupt(CYBSP_DEBUG_UART_HW, CY_SCB_UART_TX_TRIGGER);
+    }
+
+    if (NULL != debug_uart_rx_notify)
+    {
+        debug_uart_rx_notify();
+    }
+
+    TRACE_ISR_END();
+}
+
+/*******************************************************************************
+* Function Name: debug_uart_rx_wake_isr
+********************************************************************************
+* Summary:
+* RX pin interrupt handler. The SCB does not receive in Deep Sleep, so a
+* falling edge on the RX pin wakes the device up instead. The byte that caused
+* the wake-up is lost. The interrupt stays disarmed until armed again.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void debug_uart_rx_wake_isr(void)
+{
+    Cy_GPIO_SetInterruptMask(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN, 0UL);
+    Cy_GPIO_ClearInterrupt(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN);
+
+    if (NULL != debug_uart_rx_notify)
+    {
+        debug_uart_rx_notify();
+    }
+}
+
 /*******************************************************************************
 * Function Name: init_retarget_io
 ********************************************************************************
@@ -144,6 +358,276 @@ void init_retarget_io(void)
     /* UART SysPm callback registration for retarget-io */
     Cy_SysPm_RegisterCallback(&retarget_io_syspm_cb);
 #endif /* (CY_CFG_PWR_SYS_IDLE_MODE == CY_CFG_PWR_MODE_DEEPSLEEP) */
+
+    /* Transition notifier registration for retarget-io */
+    (void)Cy_USER_SysRegisterNotifier(&retarget_io_notifier);
+
+    /* Interrupt driven reception and transmission, bytes are buffered */
+    log_ring_init(&debug_uart_tx_ring, debug_uart_tx_buf, DEBUG_UART_TX_BUF_SIZE);
+    Cy_SCB_SetTxFifoLevel(CYBSP_DEBUG_UART_HW, DEBUG_UART_TX_FIFO_LEVEL);
+    cy_stc_sysint_t debug_uart_int_config =
+    {
+        .intrSrc = CYBSP_DEBUG_UART_IRQ,
+        .intrPriority = DEBUG_UART_IRQ_PRIORITY
+    };
+    cy_stc_sysint_t debug_uart_rx_wake_int_config =
+    {
+        .intrSrc = CYBSP_DEBUG_UART_RX_IRQ,
+        .intrPriority = DEBUG_UART_IRQ_PRIORITY
+    };
+
+    Cy_SysInt_Init(&debug_uart_int_config, debug_uart_isr);
+    Cy_SCB_SetRxInterruptMask(CYBSP_DEBUG_UART_HW, CY_SCB_RX_INTR_NOT_EMPTY);
+    NVIC_EnableIRQ(debug_uart_int_config.intrSrc);
+
+    /* RX pin wake-up, armed with retarget_io_arm_rx_wake() */
+    Cy_GPIO_SetInterruptMask(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN, 0UL);
+    Cy_GPIO_SetInterruptEdge(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN, CY_GPIO_INTR_FALLING);
+    Cy_SysInt_Init(&debug_uart_rx_wake_int_config, debug_uart_rx_wake_isr);
+    NVIC_EnableIRQ(debug_uart_rx_wake_int_config.intrSrc);
+}
+
+/*******************************************************************************
+* Function Name: retarget_io_set_rx_notify
+********************************************************************************
+* Summary:
+* Sets the function called from the interrupts when bytes were received or the
+* RX pin woke the device up.
+*
+* Parameters:
+*  notify - function called in interrupt context, NULL for none
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void retarget_io_set_rx_notify(void (*notify)(void))
+{
+    debug_uart_rx_notify = notify;
+}
+
+/*******************************************************************************
+* Function Name: retarget_io_read
+********************************************************************************
+* Summary:
+* Takes received bytes from the receive buffer.
+*
+* Parameters:
+*  buf - destination
+*  len - size of buf
+*
+* Return:
+*  uint32_t - number of bytes taken
+*
+*******************************************************************************/
+uint32_t retarget_io_read(uint8_t* buf, uint32_t len)
+{
+    uint32_t count = 0UL;
+    uint32_t head = debug_uart_rx_head;
+
+    while ((count < len) && (debug_uart_rx_tail != head))
+    {
+        buf[count++] = debug_uart_rx_buf[debug_uart_rx_tail & (DEBUG_UART_RX_BUF_SIZE - 1U)];
+        debug_uart_rx_tail++;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: retarget_io_rx_dropped
+********************************************************************************
+* Summary:
+* Returns the number of received bytes dropped on a full receive buffer.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - dropped bytes
+*
+*******************************************************************************/
+uint32_t retarget_io_rx_dropped(void)
+{
+    return debug_uart_rx_dropped;
+}
+
+/*******************************************************************************
+* Function Name: retarget_io_write
+********************************************************************************
+* Summary:
+* Sends raw bytes through the transmit buffer, in order with the log output.
+* Unlike the log output, waits for room instead of dropping the bytes.
+*
+* Parameters:
+*  data - bytes to send, at most DEBUG_UART_TX_BUF_SIZE
+*  len - number of bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void retarget_io_write(const uint8_t* data, uint32_t len)
+{
+    while (log_ring_free(&debug_uart_tx_ring) < len)
+    {
+        if (0UL != __get_PRIMASK())
+        {
+            retarget_io_flush();
+        }
+    }
+
+    (void)log_ring_write(&debug_uart_tx_ring, data, len);
+    debug_uart_tx_kick();
 }
 
+/*******************************************************************************
+* Function Name: retarget_io_log
+********************************************************************************
+* Summary:
+* Sends log output through the transmit buffer without waiting for the UART.
+* Output that does not fit is dropped as a whole and counted.
+*
+* Parameters:
+*  data - bytes to send
+*  len - number of bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void retarget_io_log(const uint8_t* data, uint32_t len)
+{
+    (void)log_ring_write(&debug_uart_tx_ring, data, len);
+    debug_uart_tx_kick();
+
+    /* Nothing drains the buffer with the interrupts disabled */
+    if (0UL != __get_PRIMASK())
+    {
+        retarget_io_flush();
+    }
+}
+
+/*******************************************************************************
+* Function Name: retarget_io_tx_idle
+********************************************************************************
+* Summary:
+* Returns true once everything written was sent, the UART can then lose its
+* clock.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool - true if nothing is left to send
+*
+*******************************************************************************/
+bool retarget_io_tx_idle(void)
+{
+    return ((0UL == log_ring_used(&debug_uart_tx_ring)) && Cy_SCB_UART_IsTxComplete(CYBSP_DEBUG_UART_HW));
+}
+
+/*******************************************************************************
+* Function Name: retarget_io_flush
+********************************************************************************
+* Summary:
+* Sends everything written and waits until it left the UART. Works with the
+* interrupts disabled as well. Does nothing before init_retarget_io().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void retarget_io_flush(void)
+{
+    uint32_t state;
+
+    if (0UL == debug_uart_tx_ring.size)
+    {
+        return;
+    }
+
+    state = Cy_SysLib_EnterCriticalSection();
+
+    while (debug_uart_tx_fill())
+    {
+    }
+    while (!Cy_SCB_UART_IsTxComplete(CYBSP_DEBUG_UART_HW))
+    {
+    }
+
+    Cy_SysLib_ExitCriticalSection(state);
+}
+
+/*******************************************************************************
+* Function Name: retarget_io_tx_ring
+********************************************************************************
+* Summary:
+* Returns the transmit buffer, for its dropped bytes and high-water mark.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  const log_ring_t* - transmit buffer
+*
+*******************************************************************************/
+const log_ring_t* retarget_io_tx_ring(void)
+{
+    return &debug_uart_tx_ring;
+}
+
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+/*******************************************************************************
+* Function Name: _write
+********************************************************************************
+* Summary:
+* Replaces the weak _write() of retarget-io, so that printf() copies its output
+* into the transmit buffer and returns without waiting for the UART. Output
+* that does not fit is dropped and counted in the transmit buffer. The other
+* toolchains keep the blocking output of retarget-io.
+*
+* Parameters:
+*  fd - file descriptor, unused
+*  ptr - output
+*  len - output length
+*
+* Return:
+*  int - len, dropped output counts as written
+*
+*******************************************************************************/
+int _write(int fd, const char* ptr, int len)
+{
+    CY_UNUSED_PARAMETER(fd);
+
+    retarget_io_log((const uint8_t*)ptr, (uint32_t)len);
+
+    return len;
+}
+#endif /* defined(__GNUC__) && !defined(__ARMCC_VERSION) */
+
+/*******************************************************************************
+* Function Name: retarget_io_arm_rx_wake
+********************************************************************************
+* Summary:
+* Arms the RX pin interrupt, so that the next byte sent to the device wakes it
+* up from Deep Sleep.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void retarget_io_arm_rx_wake(void)
+{
+    Cy_GPIO_ClearInterrupt(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN);
+    Cy_GPIO_SetInterruptMask(CYBSP_DEBUG_UART_RX_PORT, CYBSP_DEBUG_UART_RX_PIN, 1UL);
+}
+
+
 /* [] END OF FILE */
\ No newline at end of file
@@ -46,6 +46,7 @@
 #include "mtb_hal.h"
 #include "cy_retarget_io.h"
 #include "mtb_syspm_callbacks.h"
+#include "log_ring.h"
 
 /*******************************************************************************
 * Macros
@@ -59,11 +60,36 @@
 #define SYSPM_SKIP_MODE         (0U)
 #define SYSPM_CALLBACK_ORDER    (1U)
 
+/* Debug UART receive buffer size in bytes, a power of two */
+#define DEBUG_UART_RX_BUF_SIZE  (128U)
+
+/* Debug UART transmit buffer size in bytes, a power of two */
+#define DEBUG_UART_TX_BUF_SIZE  (2048U)
+
+/* The TX FIFO is topped up to this many bytes from the transmit buffer. It
+ * bounds the wait before a clock change: 8 bytes at 115200 baud take 0.7 ms. */
+#define DEBUG_UART_TX_FIFO_BURST (8U)
+
+/* The TX FIFO is topped up when it holds fewer bytes */
+#define DEBUG_UART_TX_FIFO_LEVEL (2U)
+
+/* Debug UART interrupt and RX pin wake-up interrupt priority */
+#define DEBUG_UART_IRQ_PRIORITY (6U)
+
 
 /*******************************************************************************
 * Function prototypes
 *******************************************************************************/
 void init_retarget_io(void);
+void retarget_io_set_rx_notify(void (*notify)(void));
+uint32_t retarget_io_read(uint8_t* buf, uint32_t len);
+uint32_t retarget_io_rx_dropped(void);
+void retarget_io_write(const uint8_t* data, uint32_t len);
+void retarget_io_log(const uint8_t* data, uint32_t len);
+bool retarget_io_tx_idle(void);
+void retarget_io_flush(void);
+const log_ring_t* retarget_io_tx_ring(void);
+void retarget_io_arm_rx_wake(void);
 
 /*******************************************************************************
 * Function Name: handle_app_error
@@ -83,6 +109,9 @@ __STATIC_INLINE void handle_app_error(void)
     /* Disable all interrupts. */
     __disable_irq();
 
+    /* Nothing drains the transmit buffer from now on */
+    retarget_io_flush();
+
     CY_ASSERT(0);
 
     /* Infinite loop */
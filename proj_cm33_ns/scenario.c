@@ -0,0 +1,619 @@
+/*******************************************************************************
+ * File Name:   scenario.c
+ *
+ * Description: This file contains the power transition scenario playback
+ *              engine. A scenario is a table of steps: power mode switches,
+ *              synthetic workloads, idle dwells and Deep Sleep intervals. The
+ *              engine runs it for a number of iterations from the event
+ *              scheduler and records the latency and the failures of every
+ *              step. Scenarios can be written as text and parsed into a table.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+
+#include "scenario.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Longest step duration, keeps the tick and microsecond arithmetic in range */
+#define SCENARIO_MAX_MS             (3600000UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Scenario text keywords, the mode steps are named after the power mode */
+static const char* const scenario_op_names[SCENARIO_OP_MAX] =
+{
+    "mode", "work", "dwell", "ds"
+};
+
+static const char* const scenario_level_names[DVFS_LEVEL_MAX] =
+{
+    "ulp", "lp", "hp"
+};
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: is_separator
+********************************************************************************
+* Summary:
+* Returns true for the characters separating the scenario text tokens.
+*
+* Parameters:
+*  c - character
+*
+* Return:
+*  bool - true for white space, ',' and ';'
+*
+*******************************************************************************/
+static bool is_separator(char c)
+{
+    return ((' ' == c) || ('\t' == c) || ('\r' == c) || ('\n' == c) || (',' == c) || (';' == c));
+}
+
+/*******************************************************************************
+* Function Name: skip_blank
+********************************************************************************
+* Summary:
+* Skips separators and comments, which run from '#' to the end of the line.
+*
+* Parameters:
+*  text - scenario text
+*  pos - current position
+*
+* Return:
+*  size_t - position of the next token or of the terminating NUL
+*
+*******************************************************************************/
+static size_t skip_blank(const char* text, size_t pos)
+{
+    while (('\0' != text[pos]) && (is_separator(text[pos]) || ('#' == text[pos])))
+    {
+        if ('#' == text[pos])
+        {
+            while (('\0' != text[pos]) && ('\n' != text[pos]))
+            {
+                pos++;
+            }
+        }
+        else
+        {
+            pos++;
+        }
+    }
+
+    return pos;
+}
+
+/*******************************************************************************
+* Function Name: token_len
+********************************************************************************
+* Summary:
+* Returns the length of the token at the current position.
+*
+* Parameters:
+*  text - scenario text
+*  pos - start of the token
+*
+* Return:
+*  size_t - token length
+*
+*******************************************************************************/
+static size_t token_len(const char* text, size_t pos)
+{
+    size_t len = 0U;
+
+    while (('\0' != text[pos + len]) && !is_separator(text[pos + len]) && ('#' != text[pos + len]))
+    {
+        len++;
+    }
+
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: token_is
+********************************************************************************
+* Summary:
+* Compares a token with a keyword.
+*
+* Parameters:
+*  tok - token
+*  len - token length
+*  name - keyword
+*
+* Return:
+*  bool - true if the token is the keyword
+*
+*******************************************************************************/
+static bool token_is(const char* tok, size_t len, const char* name)
+{
+    size_t i = 0U;
+
+    while ((i < len) && ('\0' != name[i]) && (tok[i] == name[i]))
+    {
+        i++;
+    }
+
+    return ((i == len) && ('\0' == name[i]));
+}
+
+/*******************************************************************************
+* Function Name: scenario_parse
+********************************************************************************
+* Summary:
+* Parses a scenario text into a step table. The text is a list of steps
+* separated by white space, ',' or ';', with comments from '#' to the end of
+* the line:
+*   hp | lp | ulp   switch to the power mode
+*   work <ms>       run the synthetic workload
+*   dwell <ms>      idle through the scheduler
+*   ds <ms>         stay in Deep Sleep
+*
+* Parameters:
+*  text - scenario text, NUL terminated
+*  steps - returns the steps
+*  max_steps - size of steps
+*  num_steps - returns the number of steps parsed
+*  error_pos - returns the offset of the token that failed, can be NULL
+*
+* Return:
+*  bool - false if the text is empty, malformed or has too many steps
+*
+*******************************************************************************/
+bool scenario_parse(const char* text, scenario_step_t* steps, uint32_t max_steps, uint32_t* num_steps,
+                    uint32_t* error_pos)
+{
+    size_t pos = skip_blank(text, 0U);
+    size_t start = pos;
+    uint32_t count = 0UL;
+    bool ok = true;
+
+    while (ok && ('\0' != text[pos]))
+    {
+        size_t len = token_len(text, pos);
+        scenario_step_t step = { SCENARIO_OP_MAX, 0UL };
+
+        start = pos;
+
+        for (uint32_t level = 0U; level < (uint32_t)DVFS_LEVEL_MAX; level++)
+        {
+            if (token_is(&text[pos], len, scenario_level_names[level]))
+            {
+                step.op = SCENARIO_OP_MODE;
+                step.arg = level;
+            }
+        }
+
+        for (uint32_t op = (uint32_t)SCENARIO_OP_WORK; op < (uint32_t)SCENARIO_OP_MAX; op++)
+        {
+            if (token_is(&text[pos], len, scenario_op_names[op]))
+            {
+                step.op = (scenario_op_t)op;
+            }
+        }
+
+        pos += len;
+
+        if ((SCENARIO_OP_MODE != step.op) && (SCENARIO_OP_MAX != step.op))
+        {
+            /* The duration follows in milliseconds */
+            pos = skip_blank(text, pos);
+            start = pos;
+            len = token_len(text, pos);
+
+            for (size_t i = 0U; ok && (i < len); i++)
+            {
+                ok = ((text[pos + i] >= '0') && (text[pos + i] <= '9'));
+                step.arg = ok ? ((step.arg * 10UL) + (uint32_t)(text[pos + i] - '0')) : 0UL;
+                ok = ok && (step.arg <= SCENARIO_MAX_MS);
+            }
+
+            ok = ok && (0UL != step.arg);
+            pos += len;
+        }
+
+        ok = ok && (SCENARIO_OP_MAX != step.op) && (count < max_steps);
+        if (ok)
+        {
+            steps[count++] = step;
+            pos = skip_blank(text, pos);
+            start = pos;
+        }
+    }
+
+    ok = ok && (0UL != count);
+
+    if ((!ok) && (NULL != error_pos))
+    {
+        *error_pos = (uint32_t)start;
+    }
+    *num_steps = count;
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: scenario_init
+********************************************************************************
+* Summary:
+* Initializes the engine.
+*
+* Parameters:
+*  sc - engine state
+*  sched - scheduler running the steps
+*  hooks - hardware interface, must stay valid
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scenario_init(scenario_t* sc, event_sched_t* sched, const scenario_hooks_t* hooks)
+{
+    sc->sched = sched;
+    sc->hooks = hooks;
+    sc->timer.active = false;
+    sc->num_steps = 0UL;
+    sc->iterations = 0UL;
+    sc->running = false;
+}
+
+/*******************************************************************************
+* Function Name: scenario_load
+********************************************************************************
+* Summary:
+* Loads a step table. The steps are copied.
+*
+* Parameters:
+*  sc - engine state
+*  steps - step table
+*  num_steps - number of steps
+*  iterations - times the table is run
+*
+* Return:
+*  bool - false if the engine is running or the table is empty or too long
+*
+*******************************************************************************/
+bool scenario_load(scenario_t* sc, const scenario_step_t* steps, uint32_t num_steps, uint32_t iterations)
+{
+    if (sc->running || (0UL == num_steps) || (num_steps > SCENARIO_MAX_STEPS) || (0UL == iterations))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0U; i < num_steps; i++)
+    {
+        sc->steps[i] = steps[i];
+    }
+    sc->num_steps = num_steps;
+    sc->iterations = iterations;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: record
+********************************************************************************
+* Summary:
+* Accounts a completed step.
+*
+* Parameters:
+*  stats - results of the step
+*  ok - false if the step failed
+*  elapsed_us - time the step took
+*  nominal_us - nominal duration of the step
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void record(scenario_stats_t* stats, bool ok, uint32_t elapsed_us, uint32_t nominal_us)
+{
+    uint32_t latency = (elapsed_us > nominal_us) ? (elapsed_us - nominal_us) : 0UL;
+
+    stats->runs++;
+    stats->total_us += latency;
+
+    if (!ok)
+    {
+        stats->failures++;
+    }
+    if (latency < stats->min_us)
+    {
+        stats->min_us = latency;
+    }
+    if (latency > stats->max_us)
+    {
+        stats->max_us = latency;
+    }
+}
+
+/*******************************************************************************
+* Function Name: run_step
+********************************************************************************
+* Summary:
+* Runs a step that completes in the calling context.
+*
+* Parameters:
+*  sc - engine state
+*  step - step to run
+*
+* Return:
+*  bool - false if the step failed
+*
+*******************************************************************************/
+static bool run_step(scenario_t* sc, const scenario_step_t* step)
+{
+    const scenario_hooks_t* hooks = sc->hooks;
+    bool ok = false;
+
+    switch (step->op)
+    {
+        case SCENARIO_OP_MODE:
+            ok = hooks->set_mode((dvfs_level_t)step->arg, hooks->arg);
+            break;
+
+        case SCENARIO_OP_WORK:
+            ok = hooks->work(step->arg, hooks->arg);
+            break;
+
+        case SCENARIO_OP_DEEPSLEEP:
+            ok = hooks->deep_sleep(step->arg, hooks->arg);
+            break;
+
+        default:
+            break;
+    }
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: step_timer_cb
+********************************************************************************
+* Summary:
+* Scheduler timer callback, runs one step. A dwell arms the timer for its
+* duration and completes on the next call, the other steps complete at once.
+* The next step is started from a new timer expiry, so the events posted
+* meanwhile are handled between the steps.
+*
+* Parameters:
+*  arg - engine state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void step_timer_cb(void* arg)
+{
+    scenario_t* sc = (scenario_t*)arg;
+    const scenario_hooks_t* hooks = sc->hooks;
+    const scenario_step_t* step = &sc->steps[sc->step];
+    uint32_t delay = 0UL;
+    uint32_t start;
+    bool ok = true;
+
+    if ((SCENARIO_OP_DWELL == step->op) && !sc->dwelling)
+    {
+        sc->dwelling = true;
+        sc->start_us = hooks->now_us(hooks->arg);
+        delay = (uint32_t)(((uint64_t)step->arg * hooks->tick_hz) / 1000ULL);
+    }
+    else
+    {
+        if (sc->dwelling)
+        {
+            sc->dwelling = false;
+            start = sc->start_us;
+        }
+        else
+        {
+            start = hooks->now_us(hooks->arg);
+            ok = run_step(sc, step);
+        }
+
+        record(&sc->stats[sc->step], ok, hooks->now_us(hooks->arg) - start,
+               (SCENARIO_OP_MODE == step->op) ? 0UL : (step->arg * 1000UL));
+
+        if (++sc->step == sc->num_steps)
+        {
+            sc->step = 0UL;
+            sc->iteration++;
+
+            if (NULL != hooks->iteration_done)
+            {
+                hooks->iteration_done(sc->iteration, hooks->arg);
+            }
+
+            if (sc->iteration == sc->iterations)
+            {
+                sc->running = false;
+
+                if (NULL != hooks->done)
+                {
+                    hooks->done(hooks->arg);
+                }
+            }
+        }
+    }
+
+    if (sc->running)
+    {
+        event_sched_timer_start(sc->sched, &sc->timer, delay, 0UL, step_timer_cb, sc);
+    }
+}
+
+/*******************************************************************************
+* Function Name: scenario_start
+********************************************************************************
+* Summary:
+* Clears the results and starts the loaded scenario from its first step.
+*
+* Parameters:
+*  sc - engine state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scenario_start(scenario_t* sc)
+{
+    if (0UL == sc->num_steps)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < sc->num_steps; i++)
+    {
+        sc->stats[i].runs = 0UL;
+        sc->stats[i].failures = 0UL;
+        sc->stats[i].min_us = UINT32_MAX;
+        sc->stats[i].max_us = 0UL;
+        sc->stats[i].total_us = 0ULL;
+    }
+
+    sc->step = 0UL;
+    sc->iteration = 0UL;
+    sc->dwelling = false;
+    sc->running = true;
+
+    event_sched_timer_start(sc->sched, &sc->timer, 0UL, 0UL, step_timer_cb, sc);
+}
+
+/*******************************************************************************
+* Function Name: scenario_stop
+********************************************************************************
+* Summary:
+* Stops the scenario after the step in progress. The results are kept.
+*
+* Parameters:
+*  sc - engine state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scenario_stop(scenario_t* sc)
+{
+    event_sched_timer_stop(sc->sched, &sc->timer);
+    sc->running = false;
+}
+
+/*******************************************************************************
+* Function Name: scenario_running
+********************************************************************************
+* Summary:
+* Returns true while a scenario is running.
+*
+* Parameters:
+*  sc - engine state
+*
+* Return:
+*  bool - true while running
+*
+*******************************************************************************/
+bool scenario_running(const scenario_t* sc)
+{
+    return sc->running;
+}
+
+/*******************************************************************************
+* Function Name: scenario_format_step
+********************************************************************************
+* Summary:
+* Formats the results of a step as a CSV line:
+*   SCN,<step>,<op>,<arg>,<runs>,<failures>,<min us>,<avg us>,<max us>
+*
+* Parameters:
+*  sc - engine state
+*  step - step index
+*  buf - output buffer
+*  len - size of buf
+*
+* Return:
+*  int - characters written as by snprintf, negative on error
+*
+*******************************************************************************/
+int scenario_format_step(const scenario_t* sc, uint32_t step, char* buf, size_t len)
+{
+    const scenario_step_t* s;
+    const scenario_stats_t* stats;
+    uint32_t avg;
+    uint32_t min;
+    int pos;
+    int n;
+
+    if (step >= sc->num_steps)
+    {
+        return -1;
+    }
+
+    s = &sc->steps[step];
+    stats = &sc->stats[step];
+    avg = (0UL != stats->runs) ? (uint32_t)(stats->total_us / stats->runs) : 0UL;
+    min = (0UL != stats->runs) ? stats->min_us : 0UL;
+
+    if (SCENARIO_OP_MODE == s->op)
+    {
+        pos = snprintf(buf, len, "SCN,%lu,%s,%s", (unsigned long)step, scenario_op_names[s->op],
+                       scenario_level_names[s->arg]);
+    }
+    else
+    {
+        pos = snprintf(buf, len, "SCN,%lu,%s,%lu", (unsigned long)step, scenario_op_names[s->op],
+                       (unsigned long)s->arg);
+    }
+
+    if ((pos < 0) || ((size_t)pos >= len))
+    {
+        return pos;
+    }
+
+    n = snprintf(&buf[pos], len - (size_t)pos, ",%lu,%lu,%lu,%lu,%lu\r\n", (unsigned long)stats->runs,
+                 (unsigned long)stats->failures, (unsigned long)min, (unsigned long)avg,
+                 (unsigned long)stats->max_us);
+
+    return (n < 0) ? n : (pos + n);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * File Name:   scenario.h
+ *
+ * Description: This file is the public interface of scenario.c, the power
+ *              transition scenario playback engine.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _SCENARIO_H_
+#define _SCENARIO_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The engine only depends on the C library and the event scheduler so it can
+ * be built on the host */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "dvfs_governor.h"
+#include "event_sched.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Maximum number of steps in a scenario */
+#define SCENARIO_MAX_STEPS          (32U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Step operations */
+typedef enum
+{
+    SCENARIO_OP_MODE,           /* Switch to the power mode in arg, a dvfs_level_t */
+    SCENARIO_OP_WORK,           /* Run the synthetic workload for arg milliseconds */
+    SCENARIO_OP_DWELL,          /* Idle through the scheduler for arg milliseconds */
+    SCENARIO_OP_DEEPSLEEP,      /* Stay in Deep Sleep for arg milliseconds */
+    SCENARIO_OP_MAX
+} scenario_op_t;
+
+/* Scenario step */
+typedef struct
+{
+    scenario_op_t   op;
+    uint32_t        arg;
+} scenario_step_t;
+
+/* Results of one step over all iterations. The latency is the time the step
+ * took beyond its nominal duration, the whole time for a mode switch. */
+typedef struct
+{
+    uint32_t    runs;
+    uint32_t    failures;
+    uint32_t    min_us;
+    uint32_t    max_us;
+    uint64_t    total_us;
+} scenario_stats_t;
+
+/* Hardware interface of the engine. The step hooks return false on failure. */
+typedef struct
+{
+    bool        (*set_mode)(dvfs_level_t level, void* arg);
+    bool        (*work)(uint32_t ms, void* arg);
+    bool        (*deep_sleep)(uint32_t ms, void* arg);
+    uint32_t    (*now_us)(void* arg);                               /* Free-running microsecond counter */
+    void        (*iteration_done)(uint32_t iteration, void* arg);   /* Can be NULL */
+    void        (*done)(void* arg);                                 /* Can be NULL */
+    void*       arg;
+    uint32_t    tick_hz;                                            /* Scheduler tick rate */
+} scenario_hooks_t;
+
+/* Engine state */
+typedef struct
+{
+    event_sched_t*              sched;
+    event_sched_timer_t         timer;
+    const scenario_hooks_t*     hooks;
+    scenario_step_t             steps[SCENARIO_MAX_STEPS];
+    uint32_t                    num_steps;
+    uint32_t                    iterations;
+    uint32_t                    step;           /* Step to run next */
+    uint32_t                    iteration;      /* Iterations completed */
+    uint32_t                    start_us;       /* Start of the dwell in progress */
+    bool                        dwelling;
+    bool                        running;
+    scenario_stats_t            stats[SCENARIO_MAX_STEPS];
+} scenario_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+bool scenario_parse(const char* text, scenario_step_t* steps, uint32_t max_steps, uint32_t* num_steps,
+                    uint32_t* error_pos);
+void scenario_init(scenario_t* sc, event_sched_t* sched, const scenario_hooks_t* hooks);
+bool scenario_load(scenario_t* sc, const scenario_step_t* steps, uint32_t num_steps, uint32_t iterations);
+void scenario_start(scenario_t* sc);
+void scenario_stop(scenario_t* sc);
+bool scenario_running(const scenario_t* sc);
+int scenario_format_step(const scenario_t* sc, uint32_t step, char* buf, size_t len);
+
+#endif /* _SCENARIO_H_ */
+
+/* [] END OF FILE */
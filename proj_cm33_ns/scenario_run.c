@@ -0,0 +1,406 @@
+/*******************************************************************************
+ * File Name:   scenario_run.c
+ *
+ * Description: This file runs the built-in power transition scenario for soak
+ *              and performance runs. It provides the power mode, workload and
+ *              Deep Sleep steps of the scenario engine on the device and prints
+ *              the results of every step at the end of the run.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "scenario_run.h"
+
+#if defined(SCENARIO_PLAYBACK)
+
+#include <stdio.h>
+
+#include "cybsp.h"
+#include "retarget_io_init.h"
+#include "event_sched_port.h"
+#include "scenario.h"
+#include "timebase.h"
+#include "user_syspm_srf.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Times the scenario is run, can be set from the Makefile */
+#ifndef SCENARIO_ITERATIONS
+#define SCENARIO_ITERATIONS         (10000UL)
+#endif
+
+/* Iterations between two progress lines */
+#define SCENARIO_PROGRESS_ITERATIONS (1000UL)
+
+/* Words of data the synthetic workload walks through */
+#define SCENARIO_WORK_WORDS         (256U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Built-in scenario, see scenario_parse() for the syntax */
+static const char scenario_text[] =
+    "# Mode ladder with work in every mode\n"
+    "hp work 5 lp work 5 ulp work 5 dwell 20\n"
+    "# Deep Sleep entered from every mode\n"
+    "lp ds 10 hp ds 10 ulp ds 10\n"
+    "# Jumps across LP and short dwells\n"
+    "hp dwell 3 ulp dwell 3 hp\n";
+
+static scenario_t scenario;
+static void (*scenario_done_cb)(void);
+
+/* Data of the synthetic workload */
+static uint32_t work_data[SCENARIO_WORK_WORDS];
+static volatile uint32_t work_sink;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: current_level
+********************************************************************************
+* Summary:
+* Returns the current power mode as a performance level.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  dvfs_level_t - current level
+*
+*******************************************************************************/
+static dvfs_level_t current_level(void)
+{
+    dvfs_level_t level = DVFS_LEVEL_HP;
+
+    switch (Cy_USER_SysGetPowerMode())
+    {
+        case CY_USER_SYSPM_MODE_ULP:
+            level = DVFS_LEVEL_ULP;
+            break;
+
+        case CY_USER_SYSPM_MODE_LP:
+            level = DVFS_LEVEL_LP;
+            break;
+
+        default:
+            break;
+    }
+
+    return level;
+}
+
+/*******************************************************************************
+* Function Name: set_mode
+********************************************************************************
+* Summary:
+* Scenario hook, switches the power mode. Ultra Low Power mode is entered from
+* and left through Low Power mode.
+*
+* Parameters:
+*  level - target level
+*  arg - unused
+*
+* Return:
+*  bool - false if a transition failed
+*
+*******************************************************************************/
+static bool set_mode(dvfs_level_t level, void* arg)
+{
+    cy_en_user_syspm_status_t status = CY_USER_SYSPM_SUCCESS;
+    dvfs_level_t from = current_level();
+
+    CY_UNUSED_PARAMETER(arg);
+
+    while ((from != level) && (CY_USER_SYSPM_SUCCESS == status))
+    {
+        from = (from < level) ? (dvfs_level_t)(from + 1U) : (dvfs_level_t)(from - 1U);
+
+        switch (from)
+        {
+            case DVFS_LEVEL_HP:
+                status = Cy_USER_SysEnterHp();
+                break;
+
+            case DVFS_LEVEL_LP:
+                status = Cy_USER_SysEnterLp();
+                break;
+
+            default:
+                status = Cy_USER_SysEnterUlp();
+                break;
+        }
+    }
+
+    return (CY_USER_SYSPM_SUCCESS == status);
+}
+
+/*******************************************************************************
+* Function Name: work
+********************************************************************************
+* Summary:
+* Scenario hook, runs a synthetic integer and memory workload.
+*
+* Parameters:
+*  ms - duration in milliseconds
+*  arg - unused
+*
+* Return:
+*  bool - always true
+*
+*******************************************************************************/
+static bool work(uint32_t ms, void* arg)
+{
+    uint64_t end = timebase_us() + ((uint64_t)ms * 1000ULL);
+    uint32_t x = work_sink | 1UL;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    while (timebase_us() < end)
+    {
+        for (uint32_t i = 0U; i < SCENARIO_WORK_WORDS; i++)
+        {
+            /* xorshift32 mixed into the data */
+            x ^= x << 13U;
+            x ^= x >> 17U;
+            x ^= x << 5U;
+            work_data[i] = (work_data[i] * 33UL) + x;
+        }
+    }
+
+    work_sink = x ^ work_data[x % SCENARIO_WORK_WORDS];
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: deep_sleep
+********************************************************************************
+* Summary:
+* Scenario hook, stays in Deep Sleep until the interval has passed. Interrupts
+* that wake the device on the way are served after the interval.
+*
+* Parameters:
+*  ms - duration in milliseconds
+*  arg - unused
+*
+* Return:
+*  bool - false if a Deep Sleep entry failed
+*
+*******************************************************************************/
+static bool deep_sleep(uint32_t ms, void* arg)
+{
+    const event_sched_port_t* port = &event_sched_lptimer_port;
+    uint32_t end = port->now() + EVENT_SCHED_MS_TO_TICKS(ms);
+    uint32_t state;
+    bool ok = true;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    retarget_io_flush();
+
+    state = Cy_SysLib_EnterCriticalSection();
+
+    while (ok && ((int32_t)(end - port->now()) > 0) && port->set_wakeup(end))
+    {
+        ok = (CY_USER_SYSPM_SUCCESS == Cy_USER_SysEnterDS());
+    }
+
+    Cy_SysLib_ExitCriticalSection(state);
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: now_us
+********************************************************************************
+* Summary:
+* Scenario hook, returns the microsecond counter.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  uint32_t - microseconds
+*
+*******************************************************************************/
+static uint32_t now_us(void* arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    return (uint32_t)timebase_us();
+}
+
+/*******************************************************************************
+* Function Name: iteration_done
+********************************************************************************
+* Summary:
+* Scenario hook, prints the progress of the run.
+*
+* Parameters:
+*  iteration - iterations completed
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void iteration_done(uint32_t iteration, void* arg)
+{
+    CY_UNUSED_PARAMETER(arg);
+
+    if (0UL == (iteration % SCENARIO_PROGRESS_ITERATIONS))
+    {
+        printf("SCN,PROGRESS,%lu,%lu\r\n", (unsigned long)iteration, (unsigned long)timebase_ms());
+    }
+}
+
+/*******************************************************************************
+* Function Name: report_results
+********************************************************************************
+* Summary:
+* Scenario hook, prints the results of every step and returns to HP mode.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void report_results(void* arg)
+{
+    char line[96];
+
+    CY_UNUSED_PARAMETER(arg);
+
+    printf("SCN,STEP,OP,ARG,RUNS,FAILURES,MIN_US,AVG_US,MAX_US\r\n");
+    for (uint32_t i = 0U; i < scenario.num_steps; i++)
+    {
+        if (scenario_format_step(&scenario, i, line, sizeof(line)) > 0)
+        {
+            printf("%s", line);
+        }
+    }
+    printf("SCN,END\r\n");
+
+    (void)set_mode(DVFS_LEVEL_HP, NULL);
+
+    if (NULL != scenario_done_cb)
+    {
+        scenario_done_cb();
+    }
+}
+
+static const scenario_hooks_t scenario_hooks =
+{
+    .set_mode = set_mode,
+    .work = work,
+    .deep_sleep = deep_sleep,
+    .now_us = now_us,
+    .iteration_done = iteration_done,
+    .done = report_results,
+    .arg = NULL,
+    .tick_hz = EVENT_SCHED_PORT_HZ
+};
+
+/*******************************************************************************
+* Function Name: scenario_run_start
+********************************************************************************
+* Summary:
+* Parses the built-in scenario and starts it. The scenario owns the power mode
+* while it runs, and returns to HP mode before done is called.
+*
+* Parameters:
+*  sched - scheduler running the scenario, its port must be initialized
+*  done - called when the run is complete, can be NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scenario_run_start(event_sched_t* sched, void (*done)(void))
+{
+    scenario_step_t steps[SCENARIO_MAX_STEPS];
+    uint32_t num_steps = 0UL;
+    uint32_t error_pos = 0UL;
+
+    scenario_done_cb = done;
+    scenario_init(&scenario, sched, &scenario_hooks);
+
+    if (!scenario_parse(scenario_text, steps, SCENARIO_MAX_STEPS, &num_steps, &error_pos) ||
+        !scenario_load(&scenario, steps, num_steps, SCENARIO_ITERATIONS))
+    {
+        printf(" Scenario error at offset %lu\r\n", (unsigned long)error_pos);
+        if (NULL != done)
+        {
+            done();
+        }
+        return;
+    }
+
+    printf(" Running %lu iterations of the scenario, do not press USER BTN1\r\n",
+           (unsigned long)SCENARIO_ITERATIONS);
+    printf("SCN,BEGIN,%lu,%lu\r\n", (unsigned long)num_steps, (unsigned long)SCENARIO_ITERATIONS);
+
+    scenario_start(&scenario);
+}
+
+/*******************************************************************************
+* Function Name: scenario_run_active
+********************************************************************************
+* Summary:
+* Returns true while the scenario is running.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool - true while running
+*
+*******************************************************************************/
+bool scenario_run_active(void)
+{
+    return scenario_running(&scenario);
+}
+
+#endif /* defined(SCENARIO_PLAYBACK) */
+
+/* [] END OF FILE */
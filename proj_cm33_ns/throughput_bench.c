@@ -0,0 +1,320 @@
+/*******************************************************************************
+ * File Name:   throughput_bench.c
+ *
+ * Description: This file contains the compute and memory throughput benchmark,
+ *              built when THROUGHPUT_BENCHMARK is set in the Makefile. The
+ *              kernels of throughput_kernels.c run in HP, LP and ULP over
+ *              buffers in SRAM, SOCMEM and RRAM, are timed with the CPU cycle
+ *              counter, and the results are printed as CSV over the debug
+ *              UART with the energy per unit of work estimated from the
+ *              current of each mode.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "throughput_bench.h"
+
+#if defined(THROUGHPUT_BENCHMARK)
+
+#include <stdio.h>
+
+#include "cybsp.h"
+#include "retarget_io_init.h"
+#include "ipc_shared.h"
+#include "throughput_kernels.h"
+
+#include "user_syspm_srf.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Size of each buffer, a multiple of THROUGHPUT_BLOCK_BYTES */
+#define THROUGHPUT_BENCH_BYTES          (16384U)
+
+/* Kernel runs per measurement */
+#define THROUGHPUT_BENCH_PASSES         (16U)
+
+/* Measurements per kernel, the fastest is kept */
+#define THROUGHPUT_BENCH_REPEATS        (3U)
+
+/* Supply voltage the energy is estimated for */
+#define THROUGHPUT_BENCH_SUPPLY_MV      (1800U)
+
+/* The SOCMEM buffers are the unused end of the m33_m55_shared region, past
+ * the shared structures */
+#define THROUGHPUT_BENCH_SOCMEM_OFFSET  ((((uint32_t)sizeof(ipc_shared_t)) + 1023U) & ~1023UL)
+
+/* Size of one formatted result */
+#define THROUGHPUT_BENCH_LINE_LEN       (160U)
+
+/* Kernels of throughput_kernels.c there is room for in the results */
+#define THROUGHPUT_BENCH_KERNELS        (4U)
+
+/* Power modes the benchmark runs in */
+typedef enum
+{
+    THROUGHPUT_MODE_HP = 0U,
+    THROUGHPUT_MODE_LP,
+    THROUGHPUT_MODE_ULP,
+    THROUGHPUT_MODE_MAX
+} throughput_mode_t;
+
+/* Memory regions of the buffers */
+typedef enum
+{
+    THROUGHPUT_REGION_SRAM = 0U,
+    THROUGHPUT_REGION_SOCMEM,
+    THROUGHPUT_REGION_RRAM,         /* Source only, the destination is in SRAM */
+    THROUGHPUT_REGION_MAX
+} throughput_region_id_t;
+
+/* Buffers of a memory region */
+typedef struct
+{
+    uint8_t*        dst;
+    const uint8_t*  src;
+    bool            writable;       /* false if dst is not in the region */
+} throughput_region_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static const char* const throughput_mode_names[THROUGHPUT_MODE_MAX] = { "HP", "LP", "ULP" };
+static const char* const throughput_region_names[THROUGHPUT_REGION_MAX] = { "SRAM", "SOCMEM", "RRAM" };
+
+/* Index of each mode in the residency current estimates */
+static const cy_en_user_syspm_mode_t throughput_syspm_modes[THROUGHPUT_MODE_MAX] =
+{
+    CY_USER_SYSPM_MODE_HP, CY_USER_SYSPM_MODE_LP, CY_USER_SYSPM_MODE_ULP
+};
+
+static uint32_t bench_sram_src[THROUGHPUT_BENCH_BYTES / sizeof(uint32_t)];
+static uint32_t bench_sram_dst[THROUGHPUT_BENCH_BYTES / sizeof(uint32_t)];
+
+/* Initialized and constant, so linked into RRAM with the code */
+static const uint32_t bench_rram_src[THROUGHPUT_BENCH_BYTES / sizeof(uint32_t)] = { 0x5A5A5A5AUL };
+
+static throughput_region_t bench_regions[THROUGHPUT_REGION_MAX];
+static throughput_result_t bench_results[THROUGHPUT_MODE_MAX][THROUGHPUT_REGION_MAX][THROUGHPUT_BENCH_KERNELS];
+static uint32_t bench_current_ua[THROUGHPUT_MODE_MAX];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: measure
+********************************************************************************
+* Summary:
+*  Runs a kernel over the buffers of a region with interrupts disabled and
+*  keeps the fastest of THROUGHPUT_BENCH_REPEATS measurements. The wall time is
+*  derived from the cycles and the CPU clock of the current power mode.
+*
+* Parameters:
+*  kernel - kernel
+*  region - buffers
+*  res - result, the current and supply voltage are set by the caller
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void measure(const throughput_kernel_t* kernel, const throughput_region_t* region,
+                    throughput_result_t* res)
+{
+    for (uint32_t r = 0U; r < THROUGHPUT_BENCH_REPEATS; r++)
+    {
+        uint32_t irq = Cy_SysLib_EnterCriticalSection();
+        uint32_t start = DWT->CYCCNT;
+        uint32_t checksum = throughput_run(kernel, region->dst, region->src, THROUGHPUT_BENCH_BYTES,
+                                           THROUGHPUT_BENCH_PASSES, &res->units);
+        uint32_t cycles = DWT->CYCCNT - start;
+
+        Cy_SysLib_ExitCriticalSection(irq);
+
+        if ((0U == r) || (cycles < res->cycles))
+        {
+            res->cycles = cycles;
+        }
+        res->checksum = checksum;
+    }
+
+    res->time_us = (uint32_t)(((uint64_t)res->cycles * 1000000U) / SystemCoreClock);
+}
+
+/*******************************************************************************
+* Function Name: run_mode
+********************************************************************************
+* Summary:
+*  Measures every kernel over the buffers of every region in the current power
+*  mode. Kernels that only write are not run for regions that cannot be
+*  written.
+*
+* Parameters:
+*  mode - current power mode
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void run_mode(throughput_mode_t mode)
+{
+    for (uint32_t region = 0U; region < (uint32_t)THROUGHPUT_REGION_MAX; region++)
+    {
+        for (uint32_t k = 0U; k < throughput_num_kernels; k++)
+        {
+            throughput_result_t* res = &bench_results[mode][region][k];
+
+            if (bench_regions[region].writable || throughput_kernels[k].reads_src)
+            {
+                res->current_ua = bench_current_ua[mode];
+                res->supply_mv = THROUGHPUT_BENCH_SUPPLY_MV;
+                measure(&throughput_kernels[k], &bench_regions[region], res);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: print_results
+********************************************************************************
+* Summary:
+*  Prints the results as CSV lines framed by:
+*  TPUTBENCH,BEGIN,<buffer bytes>,<passes>,<supply_mv>
+*  TPUTBENCH,END
+*  Kernels that were not run are left out.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_results(void)
+{
+    static char line[THROUGHPUT_BENCH_LINE_LEN];
+
+    printf("TPUTBENCH,BEGIN,%u,%u,%u\r\n", (unsigned int)THROUGHPUT_BENCH_BYTES,
+           (unsigned int)THROUGHPUT_BENCH_PASSES, (unsigned int)THROUGHPUT_BENCH_SUPPLY_MV);
+
+    for (uint32_t mode = 0U; mode < (uint32_t)THROUGHPUT_MODE_MAX; mode++)
+    {
+        for (uint32_t region = 0U; region < (uint32_t)THROUGHPUT_REGION_MAX; region++)
+        {
+            for (uint32_t k = 0U; k < throughput_num_kernels; k++)
+            {
+                if (0UL != bench_results[mode][region][k].units)
+                {
+                    (void)throughput_format(&bench_results[mode][region][k], throughput_mode_names[mode],
+                                            throughput_kernels[k].name, throughput_region_names[region],
+                                            throughput_kernels[k].unit, line, sizeof(line));
+                    printf("%s", line);
+                }
+            }
+        }
+    }
+
+    printf("TPUTBENCH,END\r\n");
+}
+
+/*******************************************************************************
+* Function Name: throughput_bench_run
+********************************************************************************
+* Summary:
+*  Runs the benchmark in HP, LP and ULP and prints the results. Must be called
+*  in HP, which is entered again before returning. The energy uses the current
+*  estimates of the secure side residency accounting.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void throughput_bench_run(void)
+{
+    cy_stc_user_syspm_residency_t residency;
+    uint8_t* socmem = (uint8_t*)IPC_SHARED_PTR(THROUGHPUT_BENCH_SOCMEM_OFFSET);
+
+    CY_ASSERT(throughput_num_kernels <= THROUGHPUT_BENCH_KERNELS);
+    CY_ASSERT((THROUGHPUT_BENCH_SOCMEM_OFFSET + (2U * THROUGHPUT_BENCH_BYTES)) <=
+              CYMEM_CM33_0_m33_m55_shared_SIZE);
+
+    if (CY_USER_SYSPM_SUCCESS == Cy_USER_SysGetResidency(&residency, false))
+    {
+        for (uint32_t mode = 0U; mode < (uint32_t)THROUGHPUT_MODE_MAX; mode++)
+        {
+            bench_current_ua[mode] = residency.current_ua[throughput_syspm_modes[mode]];
+        }
+    }
+
+    for (uint32_t i = 0U; i < (THROUGHPUT_BENCH_BYTES / sizeof(uint32_t)); i++)
+    {
+        bench_sram_src[i] = (i * 2654435761UL) ^ 0x5A5A5A5AUL;
+        ((uint32_t*)(void*)socmem)[i] = bench_sram_src[i];
+    }
+
+    bench_regions[THROUGHPUT_REGION_SRAM] =
+        (throughput_region_t){ (uint8_t*)bench_sram_dst, (const uint8_t*)bench_sram_src, true };
+    bench_regions[THROUGHPUT_REGION_SOCMEM] =
+        (throughput_region_t){ &socmem[THROUGHPUT_BENCH_BYTES], socmem, true };
+    bench_regions[THROUGHPUT_REGION_RRAM] =
+        (throughput_region_t){ (uint8_t*)bench_sram_dst, (const uint8_t*)bench_rram_src, false };
+
+    /* Enable the CPU cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    printf(" Running throughput benchmark\r\n");
+    retarget_io_flush();
+
+    run_mode(THROUGHPUT_MODE_HP);
+    (void)Cy_USER_SysEnterLp();
+    run_mode(THROUGHPUT_MODE_LP);
+    (void)Cy_USER_SysEnterUlp();
+    run_mode(THROUGHPUT_MODE_ULP);
+    (void)Cy_USER_SysEnterLp();
+    (void)Cy_USER_SysEnterHp();
+
+    print_results();
+}
+
+#endif /* defined(THROUGHPUT_BENCHMARK) */
+
+/* [] END OF FILE */
@@ -0,0 +1,404 @@
+/*******************************************************************************
+ * File Name:   throughput_kernels.c
+ *
+ * Description: This file contains the compute and memory kernels of the
+ *              throughput benchmark: an integer mix, a Q15 FIR filter, memcpy
+ *              and memset. Each kernel reports its work in its own unit, and
+ *              the results are formatted as CSV with the throughput and the
+ *              estimated energy per unit of work.
+ *              Built with THROUGHPUT_HOST defined, the file is a host program
+ *              that runs the kernels for a reference baseline:
+ *              cc -O2 -DTHROUGHPUT_HOST throughput_kernels.c -o throughput
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#if defined(THROUGHPUT_HOST)
+/* For clock_gettime */
+#define _POSIX_C_SOURCE             (199309L)
+#endif /* defined(THROUGHPUT_HOST) */
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "throughput_kernels.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(THROUGHPUT_HOST)
+#include <time.h>
+#endif /* defined(THROUGHPUT_HOST) */
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Q15 rounding and saturation */
+#define Q15_SHIFT                   (15U)
+#define Q15_ROUND                   (1L << (Q15_SHIFT - 1U))
+#define Q15_MAX                     (32767L)
+#define Q15_MIN                     (-32768L)
+
+#if defined(THROUGHPUT_HOST)
+/* Buffer size of the host run, like the device benchmark. The host runs more
+ * passes to be well above the resolution of its clock. */
+#define HOST_BYTES                  (16384U)
+#define HOST_PASSES                 (1024U)
+#define HOST_REPEATS                (3U)
+#define HOST_LINE_LEN               (160U)
+#endif /* defined(THROUGHPUT_HOST) */
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Low-pass filter, symmetric, with a DC gain of about 0.9 so that full-scale
+ * input does not saturate */
+static const int16_t fir_taps[THROUGHPUT_FIR_TAPS] =
+{
+    -120, -260, -180, 420, 1610, 3180, 4610, 5508,
+    5508, 4610, 3180, 1610, 420, -180, -260, -120
+};
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: kernel_int
+********************************************************************************
+* Summary:
+* Integer kernel, mixes every source word into a state with shifts, xors, a
+* multiplication and a rotation. Bound by the CPU, one unit is one word.
+*
+* Parameters:
+*  dst - not used
+*  src - source, 4-byte aligned
+*  len - bytes of the source
+*
+* Return:
+*  uint32_t - final state
+*
+*******************************************************************************/
+static uint32_t kernel_int(uint8_t* dst, const uint8_t* src, uint32_t len)
+{
+    const uint32_t* words = (const uint32_t*)(const void*)src;
+    uint32_t state = 0x9E3779B9UL;
+
+    (void)dst;
+
+    for (uint32_t i = 0U; i < (len / sizeof(uint32_t)); i++)
+    {
+        uint32_t x = words[i] ^ state;
+
+        x ^= x << 13U;
+        x ^= x >> 17U;
+        x ^= x << 5U;
+        state = (x * 2654435761UL) + ((state << 7U) | (state >> 25U));
+    }
+
+    return state;
+}
+
+/*******************************************************************************
+* Function Name: kernel_fir
+********************************************************************************
+* Summary:
+* Fixed-point DSP kernel, filters the Q15 source samples with a
+* THROUGHPUT_FIR_TAPS tap FIR filter into the destination, with rounding and
+* saturation. One unit is one multiply-accumulate; the first samples, which
+* have fewer predecessors, are counted as full ones.
+*
+* Parameters:
+*  dst - filtered samples, 4-byte aligned
+*  src - Q15 samples, 4-byte aligned
+*  len - bytes of the source and destination
+*
+* Return:
+*  uint32_t - sum of the filtered samples
+*
+*******************************************************************************/
+static uint32_t kernel_fir(uint8_t* dst, const uint8_t* src, uint32_t len)
+{
+    const int16_t* x = (const int16_t*)(const void*)src;
+    int16_t* y = (int16_t*)(void*)dst;
+    uint32_t samples = len / sizeof(int16_t);
+    uint32_t sum = 0UL;
+
+    for (uint32_t n = 0U; n < samples; n++)
+    {
+        int32_t acc = Q15_ROUND;
+        uint32_t taps = (n < THROUGHPUT_FIR_TAPS) ? (n + 1U) : THROUGHPUT_FIR_TAPS;
+
+        for (uint32_t k = 0U; k < taps; k++)
+        {
+            acc += (int32_t)fir_taps[k] * (int32_t)x[n - k];
+        }
+
+        acc >>= Q15_SHIFT;
+        acc = (acc > Q15_MAX) ? Q15_MAX : ((acc < Q15_MIN) ? Q15_MIN : acc);
+        y[n] = (int16_t)acc;
+        sum += (uint32_t)acc;
+    }
+
+    return sum;
+}
+
+/*******************************************************************************
+* Function Name: kernel_memcpy
+********************************************************************************
+* Summary:
+* Memory kernel, copies the source to the destination with the C library.
+* One unit is one byte.
+*
+* Parameters:
+*  dst - destination
+*  src - source
+*  len - bytes to copy
+*
+* Return:
+*  uint32_t - first, middle and last byte of the copy
+*
+*******************************************************************************/
+static uint32_t kernel_memcpy(uint8_t* dst, const uint8_t* src, uint32_t len)
+{
+    (void)memcpy(dst, src, len);
+
+    return (uint32_t)dst[0] | ((uint32_t)dst[len / 2U] << 8U) | ((uint32_t)dst[len - 1U] << 16U);
+}
+
+/*******************************************************************************
+* Function Name: kernel_memset
+********************************************************************************
+* Summary:
+* Memory kernel, fills the destination with the C library. One unit is one
+* byte.
+*
+* Parameters:
+*  dst - destination
+*  src - not used
+*  len - bytes to fill
+*
+* Return:
+*  uint32_t - last byte of the destination
+*
+*******************************************************************************/
+static uint32_t kernel_memset(uint8_t* dst, const uint8_t* src, uint32_t len)
+{
+    (void)src;
+
+    (void)memset(dst, (int)(len & 0xFFU) ^ 0x5A, len);
+
+    return (uint32_t)dst[len - 1U];
+}
+
+const throughput_kernel_t throughput_kernels[] =
+{
+    { "int",    "word", THROUGHPUT_BLOCK_BYTES / sizeof(uint32_t), true, kernel_int },
+    { "fir",    "mac",  (THROUGHPUT_BLOCK_BYTES / sizeof(int16_t)) * THROUGHPUT_FIR_TAPS, true, kernel_fir },
+    { "memcpy", "byte", THROUGHPUT_BLOCK_BYTES, true, kernel_memcpy },
+    { "memset", "byte", THROUGHPUT_BLOCK_BYTES, false, kernel_memset }
+};
+
+const uint32_t throughput_num_kernels = sizeof(throughput_kernels) / sizeof(throughput_kernels[0]);
+
+/*******************************************************************************
+* Function Name: throughput_run
+********************************************************************************
+* Summary:
+* Runs a kernel over the buffers several times in a row.
+*
+* Parameters:
+*  kernel - kernel
+*  dst - destination, 4-byte aligned
+*  src - source, 4-byte aligned
+*  len - bytes of the buffers, a multiple of THROUGHPUT_BLOCK_BYTES
+*  passes - number of runs
+*  units - set to the units of work done
+*
+* Return:
+*  uint32_t - checksum of all runs
+*
+*******************************************************************************/
+uint32_t throughput_run(const throughput_kernel_t* kernel, uint8_t* dst, const uint8_t* src, uint32_t len,
+                        uint32_t passes, uint32_t* units)
+{
+    uint32_t checksum = 0UL;
+
+    for (uint32_t i = 0U; i < passes; i++)
+    {
+        checksum = (checksum * 31UL) + kernel->run(dst, src, len);
+    }
+
+    *units = kernel->units_per_block * (len / THROUGHPUT_BLOCK_BYTES) * passes;
+
+    return checksum;
+}
+
+/*******************************************************************************
+* Function Name: throughput_format
+********************************************************************************
+* Summary:
+* Formats a measurement as a CSV line:
+*  TPUT,<mode>,<kernel>,<region>,<unit>,<units>,<cycles>,<time_us>,
+*  <units_per_s>,<cycles_per_1000_units>,<pj_per_unit>,<checksum>
+* The energy is the estimated current times the supply voltage over the wall
+* time. Values that cannot be computed are 0.
+*
+* Parameters:
+*  res - measurement
+*  mode - power mode name
+*  kernel - kernel name
+*  region - memory region name
+*  unit - unit of work
+*  buf - output buffer
+*  len - size of the output buffer
+*
+* Return:
+*  size_t - length of the output, truncated to the buffer
+*
+*******************************************************************************/
+size_t throughput_format(const throughput_result_t* res, const char* mode, const char* kernel,
+                         const char* region, const char* unit, char* buf, size_t len)
+{
+    uint64_t units_per_s = 0U;
+    uint64_t cycles_per_kunit = 0U;
+    uint64_t pj_per_unit = 0U;
+    int n;
+
+    if (0UL != res->units)
+    {
+        units_per_s = (0UL == res->time_us) ? 0U : (((uint64_t)res->units * 1000000U) / res->time_us);
+        cycles_per_kunit = ((uint64_t)res->cycles * 1000U) / res->units;
+
+        /* uA * mV * us is in fJ */
+        pj_per_unit = ((uint64_t)res->current_ua * res->supply_mv * res->time_us) / (1000U * (uint64_t)res->units);
+    }
+
+    n = snprintf(buf, len, "TPUT,%s,%s,%s,%s,%lu,%lu,%lu,%llu,%llu,%llu,%08lX\r\n", mode, kernel, region, unit,
+                 (unsigned long)res->units, (unsigned long)res->cycles, (unsigned long)res->time_us,
+                 (unsigned long long)units_per_s, (unsigned long long)cycles_per_kunit,
+                 (unsigned long long)pj_per_unit, (unsigned long)res->checksum);
+
+    if (n < 0)
+    {
+        return 0U;
+    }
+
+    return ((size_t)n >= len) ? ((len > 0U) ? (len - 1U) : 0U) : (size_t)n;
+}
+
+#if defined(THROUGHPUT_HOST)
+
+/*******************************************************************************
+* Function Name: host_us
+********************************************************************************
+* Summary:
+* Returns the monotonic time of the host.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t - microseconds
+*
+*******************************************************************************/
+static uint64_t host_us(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000U) + ((uint64_t)ts.tv_nsec / 1000U);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs every kernel on the host and prints the results in the format of the
+* device benchmark, with the mode HOST and the region RAM. Cycles and energy
+* are not known and reported as 0.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0
+*
+*******************************************************************************/
+int main(void)
+{
+    static uint32_t src[HOST_BYTES / sizeof(uint32_t)];
+    static uint32_t dst[HOST_BYTES / sizeof(uint32_t)];
+    static char line[HOST_LINE_LEN];
+
+    for (uint32_t i = 0U; i < (HOST_BYTES / sizeof(uint32_t)); i++)
+    {
+        src[i] = (i * 2654435761UL) ^ 0x5A5A5A5AUL;
+    }
+
+    printf("TPUTBENCH,BEGIN,%u,%u,0\r\n", (unsigned int)HOST_BYTES, (unsigned int)HOST_PASSES);
+
+    for (uint32_t k = 0U; k < throughput_num_kernels; k++)
+    {
+        const throughput_kernel_t* kernel = &throughput_kernels[k];
+        throughput_result_t res = { 0 };
+
+        /* The fastest of the repeats, the others include cache and page faults */
+        for (uint32_t r = 0U; r < HOST_REPEATS; r++)
+        {
+            uint64_t start = host_us();
+            uint32_t checksum = throughput_run(kernel, (uint8_t*)dst, (const uint8_t*)src, HOST_BYTES,
+                                               HOST_PASSES, &res.units);
+            uint32_t us = (uint32_t)(host_us() - start);
+
+            if ((0U == r) || (us < res.time_us))
+            {
+                res.time_us = (0UL == us) ? 1UL : us;
+            }
+            res.checksum = checksum;
+        }
+
+        (void)throughput_format(&res, "HOST", kernel->name, "RAM", kernel->unit, line, sizeof(line));
+        printf("%s", line);
+    }
+
+    printf("TPUTBENCH,END\r\n");
+
+    return 0;
+}
+
+#endif /* defined(THROUGHPUT_HOST) */
+
+/* [] END OF FILE */
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * File Name:   throughput_kernels.h
+ *
+ * Description: This file is the public interface of throughput_kernels.c, the
+ *              compute and memory kernels of the throughput benchmark and the
+ *              report of their results.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _THROUGHPUT_KERNELS_H_
+#define _THROUGHPUT_KERNELS_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The kernels only depend on the C library so they can be built on the host
+ * for a reference baseline */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Buffer lengths passed to the kernels must be a multiple of this */
+#define THROUGHPUT_BLOCK_BYTES      (64U)
+
+/* Taps of the fixed-point FIR filter */
+#define THROUGHPUT_FIR_TAPS         (16U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Kernel, processes len bytes of src into dst. Returns a checksum of the
+ * result, so that the work is not optimized away and the results of different
+ * builds can be compared. */
+typedef struct
+{
+    const char* name;
+    const char* unit;               /* Unit of work */
+    uint32_t    units_per_block;    /* Units of work per THROUGHPUT_BLOCK_BYTES */
+    bool        reads_src;          /* false if only dst is accessed */
+    uint32_t    (*run)(uint8_t* dst, const uint8_t* src, uint32_t len);
+} throughput_kernel_t;
+
+/* Measurement of one kernel */
+typedef struct
+{
+    uint32_t    units;          /* Units of work done */
+    uint32_t    cycles;         /* CPU cycles, 0 if not known */
+    uint32_t    time_us;        /* Wall time */
+    uint32_t    current_ua;     /* Estimated device current, 0 if not known */
+    uint32_t    supply_mv;      /* Supply voltage the energy is estimated for */
+    uint32_t    checksum;       /* Checksum returned by the kernel */
+} throughput_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Kernels, in report order */
+extern const throughput_kernel_t throughput_kernels[];
+extern const uint32_t throughput_num_kernels;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+uint32_t throughput_run(const throughput_kernel_t* kernel, uint8_t* dst, const uint8_t* src, uint32_t len,
+                        uint32_t passes, uint32_t* units);
+size_t throughput_format(const throughput_result_t* res, const char* mode, const char* kernel,
+                         const char* region, const char* unit, char* buf, size_t len);
+
+#endif /* _THROUGHPUT_KERNELS_H_ */
+
+/* [] END OF FILE */
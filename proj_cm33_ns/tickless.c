@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * File Name:   tickless.c
+ *
+ * Description: This file contains the tick suppression arithmetic of the RTOS
+ *              tickless idle port. It converts the idle time expected by the
+ *              RTOS into a wake-up timer interval, and the time actually slept
+ *              back into whole RTOS ticks plus the remainder of the current
+ *              tick, so the tick count does not drift over many sleeps.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "tickless.h"
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: tickless_sleep_ticks
+********************************************************************************
+* Summary:
+* Returns the wake-up timer interval for an idle period. The interval ends at
+* the tick boundary the RTOS expects to wake up at, less the wake-up lead.
+*
+* Parameters:
+*  cfg - tick source and wake-up timer
+*  expected_ticks - RTOS ticks until the next task unblocks
+*  elapsed_counts - tick counter counts already elapsed in the current tick
+*
+* Return:
+*  uint32_t - wake-up timer ticks to sleep for, 0 if the tick should be kept
+*
+*******************************************************************************/
+uint32_t tickless_sleep_ticks(const tickless_cfg_t* cfg, uint32_t expected_ticks, uint32_t elapsed_counts)
+{
+    uint64_t counts = ((uint64_t)expected_ticks * cfg->tick_counts) - elapsed_counts;
+    uint64_t ticks = (counts * cfg->wake_hz) / cfg->counts_hz;
+
+    if ((0UL == expected_ticks) || (ticks < ((uint64_t)cfg->min_sleep + cfg->wake_lead)))
+    {
+        return 0UL;
+    }
+
+    ticks -= cfg->wake_lead;
+
+    /* The wake-up timer compares 32-bit ticks */
+    return (ticks > (uint64_t)INT32_MAX) ? (uint32_t)INT32_MAX : (uint32_t)ticks;
+}
+
+/*******************************************************************************
+* Function Name: tickless_step
+********************************************************************************
+* Summary:
+* Converts the time spent asleep into whole RTOS ticks and the counts left
+* until the next tick. A sleep that ran to or past the expected wake-up
+* steps one tick less and makes the next tick due at once, so the tick
+* interrupt unblocks the task as the RTOS requires.
+*
+* Parameters:
+*  cfg - tick source and wake-up timer
+*  expected_ticks - RTOS ticks the sleep was planned for
+*  elapsed_counts - tick counter counts elapsed in the tick before the sleep
+*  slept_ticks - wake-up timer ticks spent asleep
+*
+* Return:
+*  tickless_step_t - ticks to step and counts until the next tick
+*
+*******************************************************************************/
+tickless_step_t tickless_step(const tickless_cfg_t* cfg, uint32_t expected_ticks, uint32_t elapsed_counts,
+                              uint32_t slept_ticks)
+{
+    tickless_step_t step;
+    uint64_t counts = (((uint64_t)slept_ticks * cfg->counts_hz) / cfg->wake_hz) + elapsed_counts;
+    uint64_t ticks = counts / cfg->tick_counts;
+
+    if ((0UL != expected_ticks) && (ticks >= expected_ticks))
+    {
+        step.ticks = expected_ticks - 1UL;
+        step.next_counts = 1UL;
+    }
+    else
+    {
+        step.ticks = (uint32_t)ticks;
+        step.next_counts = cfg->tick_counts - (uint32_t)(counts % cfg->tick_counts);
+    }
+
+    return step;
+}
+
+/* [] END OF FILE */
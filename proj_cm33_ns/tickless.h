@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * File Name:   tickless.h
+ *
+ * Description: This file is the public interface of tickless.c, the tick
+ *              suppression arithmetic of the RTOS tickless idle port.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _TICKLESS_H_
+#define _TICKLESS_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The arithmetic only depends on the C library so it can be built on the host */
+#include <stdint.h>
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Tick source and wake-up timer of the RTOS. The tick counter counts
+ * counts_hz and wraps every tick_counts, the wake-up timer counts wake_hz
+ * and keeps running while the CPU sleeps. */
+typedef struct
+{
+    uint32_t    tick_counts;    /* Tick counter counts per RTOS tick */
+    uint32_t    counts_hz;      /* Tick counter frequency */
+    uint32_t    wake_hz;        /* Wake-up timer frequency */
+    uint32_t    wake_lead;      /* Wake-up timer ticks to wake up early by, covers the exit latency */
+    uint32_t    min_sleep;      /* Shorter sleeps are not worth stopping the tick for, in wake-up timer ticks */
+} tickless_cfg_t;
+
+/* Ticks to step the RTOS tick count by after a sleep */
+typedef struct
+{
+    uint32_t    ticks;          /* Whole RTOS ticks that passed */
+    uint32_t    next_counts;    /* Tick counter counts until the next tick is due */
+} tickless_step_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+uint32_t tickless_sleep_ticks(const tickless_cfg_t* cfg, uint32_t expected_ticks, uint32_t elapsed_counts);
+tickless_step_t tickless_step(const tickless_cfg_t* cfg, uint32_t expected_ticks, uint32_t elapsed_counts,
+                              uint32_t slept_ticks);
+
+#endif /* _TICKLESS_H_ */
+
+/* [] END OF FILE */
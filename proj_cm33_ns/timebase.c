@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * File Name:   timebase.c
+ *
+ * Description: This file contains the power mode independent timestamps and
+ *              delays. They count the LPTimer, which runs from CLK_LF in every
+ *              power mode including Deep Sleep, so unlike CPU cycle counts
+ *              they do not change with the mode the governor selects.
+ *              Cy_SysLib_Delay() stays accurate as well, because the mode
+ *              transitions update SystemCoreClock (see Cy_USER_SysGetCoreClock).
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "event_sched_port.h"
+#include "timebase.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Delays shorter than this are timed with the CPU clock, the LPTimer tick is
+ * about 30 us */
+#define TIMEBASE_SHORT_DELAY_US     (100U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Upper half of the 64-bit tick count and the last counter value read */
+static uint32_t timebase_high = 0UL;
+static uint32_t timebase_last = 0UL;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: timebase_ticks
+********************************************************************************
+* Summary:
+*  Returns the LPTimer count extended to 64 bits. The 32-bit counter wraps
+*  after about 36 hours, so it must be read at least once in that time. The
+*  scheduler port must have been initialized.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t - ticks of EVENT_SCHED_PORT_HZ
+*
+*******************************************************************************/
+uint64_t timebase_ticks(void)
+{
+    uint32_t state = Cy_SysLib_EnterCriticalSection();
+    uint32_t now = event_sched_lptimer_port.now();
+    uint64_t ticks;
+
+    if (now < timebase_last)
+    {
+        timebase_high++;
+    }
+    timebase_last = now;
+    ticks = ((uint64_t)timebase_high << 32U) | now;
+
+    Cy_SysLib_ExitCriticalSection(state);
+
+    return ticks;
+}
+
+/*******************************************************************************
+* Function Name: timebase_us
+********************************************************************************
+* Summary:
+*  Returns a timestamp in microseconds, with the resolution of one LPTimer tick.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t - microseconds
+*
+*******************************************************************************/
+uint64_t timebase_us(void)
+{
+    uint64_t ticks = timebase_ticks();
+
+    /* Split to avoid overflowing the product */
+    return ((ticks / EVENT_SCHED_PORT_HZ) * 1000000ULL) +
+           (((ticks % EVENT_SCHED_PORT_HZ) * 1000000ULL) / EVENT_SCHED_PORT_HZ);
+}
+
+/*******************************************************************************
+* Function Name: timebase_ms
+********************************************************************************
+* Summary:
+*  Returns a timestamp in milliseconds, wrapping at 32 bits.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - milliseconds
+*
+*******************************************************************************/
+uint32_t timebase_ms(void)
+{
+    return (uint32_t)(timebase_us() / 1000ULL);
+}
+
+/*******************************************************************************
+* Function Name: timebase_delay_us
+********************************************************************************
+* Summary:
+*  Busy-waits for at least the given time in any power mode. Long delays count
+*  LPTimer ticks, short ones use Cy_SysLib_DelayUs().
+*
+* Parameters:
+*  us - delay in microseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void timebase_delay_us(uint32_t us)
+{
+    if (us < TIMEBASE_SHORT_DELAY_US)
+    {
+        Cy_SysLib_DelayUs((uint16_t)us);
+    }
+    else
+    {
+        /* One extra tick covers the partial tick at the start */
+        uint32_t ticks = (uint32_t)((((uint64_t)us * EVENT_SCHED_PORT_HZ) + 999999ULL) / 1000000ULL) + 1UL;
+        uint32_t start = event_sched_lptimer_port.now();
+
+        while ((event_sched_lptimer_port.now() - start) < ticks)
+        {
+        }
+    }
+}
+
+/* [] END OF FILE */
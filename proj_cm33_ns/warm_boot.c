@@ -0,0 +1,283 @@
+/*******************************************************************************
+ * File Name:   warm_boot.c
+ *
+ * Description: This file contains the warm-boot record and boot-phase timing.
+ *              The record is armed right before a deep power state that wakes
+ *              up through a reset. On the next boot, a valid record tells the
+ *              application which set-up phases it can skip and which state to
+ *              resume with.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "warm_boot.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* FNV-1a parameters */
+#define FNV_OFFSET_BASIS    (0x811C9DC5UL)
+#define FNV_PRIME           (0x01000193UL)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: fnv1a
+********************************************************************************
+* Summary:
+* Continues an FNV-1a hash over a block of bytes.
+*
+* Parameters:
+*  hash - hash so far
+*  data - bytes to hash
+*  len - number of bytes
+*
+* Return:
+*  uint32_t - updated hash
+*
+*******************************************************************************/
+static uint32_t fnv1a(uint32_t hash, const uint8_t* data, size_t len)
+{
+    for (size_t i = 0U; i < len; i++)
+    {
+        hash = (hash ^ data[i]) * FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/*******************************************************************************
+* Function Name: record_checksum
+********************************************************************************
+* Summary:
+* Computes the checksum of every record field before the checksum itself.
+*
+* Parameters:
+*  rec - warm-boot record
+*
+* Return:
+*  uint32_t - checksum
+*
+*******************************************************************************/
+static uint32_t record_checksum(const warm_boot_record_t* rec)
+{
+    return fnv1a(FNV_OFFSET_BASIS, (const uint8_t*)rec, offsetof(warm_boot_record_t, checksum));
+}
+
+/*******************************************************************************
+* Function Name: warm_boot_image_id
+********************************************************************************
+* Summary:
+* Derives the image identifier from a string unique to the build, so that a
+* record armed by a different image is never resumed.
+*
+* Parameters:
+*  build_str - build identification string, e.g. __DATE__ " " __TIME__
+*
+* Return:
+*  uint32_t - image identifier
+*
+*******************************************************************************/
+uint32_t warm_boot_image_id(const char* build_str)
+{
+    size_t len = 0U;
+
+    while ('\0' != build_str[len])
+    {
+        len++;
+    }
+
+    return fnv1a(FNV_OFFSET_BASIS, (const uint8_t*)build_str, len);
+}
+
+/*******************************************************************************
+* Function Name: warm_boot_arm
+********************************************************************************
+* Summary:
+* Seals the record before entering a deep power state.
+*
+* Parameters:
+*  rec - warm-boot record
+*  image_id - identifier of the running image
+*  preserved - phases whose state survives the power state, bit per phase
+*  context - WARM_BOOT_CONTEXT_WORDS words of application state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void warm_boot_arm(warm_boot_record_t* rec, uint32_t image_id, uint32_t preserved, const uint32_t* context)
+{
+    rec->magic = WARM_BOOT_MAGIC;
+    rec->image_id = image_id;
+    rec->preserved = preserved;
+
+    for (uint32_t i = 0U; i < WARM_BOOT_CONTEXT_WORDS; i++)
+    {
+        rec->context[i] = context[i];
+    }
+
+    rec->checksum = record_checksum(rec);
+}
+
+/*******************************************************************************
+* Function Name: warm_boot_disarm
+********************************************************************************
+* Summary:
+* Invalidates the record, e.g. when the power state entry was aborted.
+*
+* Parameters:
+*  rec - warm-boot record
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void warm_boot_disarm(warm_boot_record_t* rec)
+{
+    rec->magic = 0UL;
+}
+
+/*******************************************************************************
+* Function Name: warm_boot_resume
+********************************************************************************
+* Summary:
+* Validates and consumes the record at boot.
+*
+* Parameters:
+*  rec - warm-boot record
+*  image_id - identifier of the running image
+*  context - returns the saved application state on a warm boot
+*
+* Return:
+*  uint32_t - phases that can be skipped, 0 for a cold boot
+*
+*******************************************************************************/
+uint32_t warm_boot_resume(warm_boot_record_t* rec, uint32_t image_id, uint32_t* context)
+{
+    uint32_t preserved = 0UL;
+
+    if ((WARM_BOOT_MAGIC == rec->magic) && (image_id == rec->image_id) &&
+        (record_checksum(rec) == rec->checksum))
+    {
+        preserved = rec->preserved;
+
+        for (uint32_t i = 0U; i < WARM_BOOT_CONTEXT_WORDS; i++)
+        {
+            context[i] = rec->context[i];
+        }
+    }
+
+    /* A record is resumed at most once */
+    warm_boot_disarm(rec);
+
+    return preserved;
+}
+
+/*******************************************************************************
+* Function Name: warm_boot_timing_start
+********************************************************************************
+* Summary:
+* Starts the boot-phase timing.
+*
+* Parameters:
+*  timing - boot-phase timing
+*  warm - boot resumed from an armed record
+*  now - current counter value
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void warm_boot_timing_start(warm_boot_timing_t* timing, bool warm, uint32_t now)
+{
+    timing->warm = warm;
+    timing->start = now;
+
+    for (uint32_t i = 0U; i < (uint32_t)WARM_BOOT_PHASE_MAX; i++)
+    {
+        timing->phase_end[i] = now;
+    }
+}
+
+/*******************************************************************************
+* Function Name: warm_boot_timing_mark
+********************************************************************************
+* Summary:
+* Records the end of a boot phase. A skipped phase is marked with the end of
+* the previous phase, so that its duration is zero.
+*
+* Parameters:
+*  timing - boot-phase timing
+*  phase - phase that ended
+*  now - current counter value
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void warm_boot_timing_mark(warm_boot_timing_t* timing, warm_boot_phase_t phase, uint32_t now)
+{
+    for (uint32_t i = (uint32_t)phase; i < (uint32_t)WARM_BOOT_PHASE_MAX; i++)
+    {
+        timing->phase_end[i] = now;
+    }
+}
+
+/*******************************************************************************
+* Function Name: warm_boot_timing_phase
+********************************************************************************
+* Summary:
+* Returns the duration of a boot phase in counter ticks.
+*
+* Parameters:
+*  timing - boot-phase timing
+*  phase - boot phase
+*
+* Return:
+*  uint32_t - duration of the phase
+*
+*******************************************************************************/
+uint32_t warm_boot_timing_phase(const warm_boot_timing_t* timing, warm_boot_phase_t phase)
+{
+    uint32_t begin = (WARM_BOOT_PHASE_BSP == phase) ? timing->start : timing->phase_end[phase - 1U];
+
+    return timing->phase_end[phase] - begin;
+}
+
+/* [] END OF FILE */
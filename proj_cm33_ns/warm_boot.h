@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * File Name:   warm_boot.h
+ *
+ * Description: This file is the public interface of warm_boot.c, the warm-boot
+ *              record used to resume the application after a reset-style
+ *              wake-up, and the boot-phase timing.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _WARM_BOOT_H_
+#define _WARM_BOOT_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The record logic only depends on the C library so it can be built on the host */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Words of application state carried across the wake-up */
+#define WARM_BOOT_CONTEXT_WORDS     (4U)
+
+/* Identifies an armed record */
+#define WARM_BOOT_MAGIC             (0x57424F54UL)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Boot phases of the non-secure application */
+typedef enum
+{
+    WARM_BOOT_PHASE_BSP = 0U,       /* cybsp_init() */
+    WARM_BOOT_PHASE_SRF,            /* SRF memory pool */
+    WARM_BOOT_PHASE_RETARGET_IO,    /* Debug UART and retarget-io */
+    WARM_BOOT_PHASE_APP,            /* Callbacks and interrupts */
+    WARM_BOOT_PHASE_CM55,           /* CM55 boot */
+    WARM_BOOT_PHASE_BANNER,         /* Start-up messages */
+    WARM_BOOT_PHASE_MAX
+} warm_boot_phase_t;
+
+/* Record kept in storage that survives the deep power state, e.g. the
+ * backup-domain registers */
+typedef struct
+{
+    uint32_t magic;                             /* WARM_BOOT_MAGIC when armed */
+    uint32_t image_id;                          /* Image that armed the record */
+    uint32_t preserved;                         /* Phases whose state survives, bit per phase */
+    uint32_t context[WARM_BOOT_CONTEXT_WORDS];  /* Application state to resume with */
+    uint32_t checksum;
+} warm_boot_record_t;
+
+/* Timestamps of the boot phases in a free-running counter */
+typedef struct
+{
+    bool        warm;                           /* Boot resumed from an armed record */
+    uint32_t    start;                          /* Counter value at the start of the boot */
+    uint32_t    phase_end[WARM_BOOT_PHASE_MAX]; /* Counter value at the end of each phase */
+} warm_boot_timing_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+uint32_t warm_boot_image_id(const char* build_str);
+void warm_boot_arm(warm_boot_record_t* rec, uint32_t image_id, uint32_t preserved, const uint32_t* context);
+void warm_boot_disarm(warm_boot_record_t* rec);
+uint32_t warm_boot_resume(warm_boot_record_t* rec, uint32_t image_id, uint32_t* context);
+void warm_boot_timing_start(warm_boot_timing_t* timing, bool warm, uint32_t now);
+void warm_boot_timing_mark(warm_boot_timing_t* timing, warm_boot_phase_t phase, uint32_t now);
+uint32_t warm_boot_timing_phase(const warm_boot_timing_t* timing, warm_boot_phase_t phase);
+
+#endif /* _WARM_BOOT_H_ */
+
+/* [] END OF FILE */
@@ -44,6 +44,7 @@
 #include "cybsp.h"
 
 #include "user_srf.h"
+#include "trace.h"
 
 /*****************************************************************************
 * Macros
@@ -250,6 +251,12 @@ int main(void)
     uint32_t ns_stack;
     cy_cmse_funcptr NonSecure_ResetHandler;
     cy_rslt_t result;
+    cy_stc_user_syspm_ds_modes_t ds_modes =
+    {
+        .sys_mode = (uint32_t)CY_SYSPM_MODE_DEEPSLEEP,
+        .app_mode = (uint32_t)CY_SYSPM_MODE_DEEPSLEEP,
+        .socmem_mode = (uint32_t)CY_SYSPM_MODE_DEEPSLEEP
+    };
 
     /* Set up internal routing, pins, and clock-to-peripheral connections */
     result = cybsp_init();
@@ -280,6 +287,9 @@ int main(void)
         while(true);
     }
 
+    /* Start the secure event trace, a no-op unless TRACE_TIMELINE is set */
+    TRACE_INIT();
+
     /* Enable global interrupts */
     __enable_irq();
 
@@ -297,35 +307,9 @@ int main(void)
     /* Register the ULP transition callback */
     Cy_SysPm_RegisterCallback(&user_syspm_ulp_cb);
 
-    /* System Domain Idle Power Mode Configuration */
-    result = (cy_rslt_t)Cy_SysPm_SetDeepSleepMode(CY_SYSPM_MODE_DEEPSLEEP);
-    if (result != CY_RSLT_SUCCESS)
-    {
-        /* Disable all interrupts. */
-        __disable_irq();
-
-        CY_ASSERT(0);
-
-        /* Infinite loop */
-        while(true);
-    }
-
-    /* App Domain Idle Power Mode Configuration */
-    result = (cy_rslt_t)Cy_SysPm_SetAppDeepSleepMode(CY_SYSPM_MODE_DEEPSLEEP);
-    if (result != CY_RSLT_SUCCESS)
-    {
-        /* Disable all interrupts. */
-        __disable_irq();
-
-        CY_ASSERT(0);
-
-        /* Infinite loop */
-        while(true);
-    }
-
-    /* System SRAM (SoCMEM) Idle Power Mode Configuration */
-    result = (cy_rslt_t)Cy_SysPm_SetSOCMEMDeepSleepMode(CY_SYSPM_MODE_DEEPSLEEP);
-    if (result != CY_RSLT_SUCCESS)
+    /* System, App Domain and System SRAM (SoCMEM) Idle Power Mode Configuration.
+     * The non-secure application can change these at runtime. */
+    if (CY_USER_SYSPM_SUCCESS != Cy_USER_SysSetDeepSleepModes(&ds_modes, NULL))
     {
         /* Disable all interrupts. */
         __disable_irq();
@@ -40,6 +40,142 @@
 *******************************************************************************/
 
 #include "cybsp.h"
+#include "ipc_shared.h"
+#include "ipc_doorbell.h"
+#include "job_ring.h"
+#include "trace.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Job doorbell interrupt priority */
+#define DOORBELL_IRQ_PRIORITY (3U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Consumer side of the job ring */
+static job_ring_consumer_t job_consumer;
+
+/* Set by the doorbell, the first pass picks up jobs queued before the boot */
+static volatile bool doorbell_rung = true;
+
+/*******************************************************************************
+* Function Name: doorbell_isr
+********************************************************************************
+* Summary:
+* Job doorbell interrupt handler, wakes the CPU to drain the job ring.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void doorbell_isr(void)
+{
+    TRACE_ISR_BEGIN();
+    ipc_doorbell_clear(IPC_DOORBELL_CM55);
+    TRACE_INSTANT(TRACE_EV_IPC_ACK, IPC_DOORBELL_CM55);
+    doorbell_rung = true;
+    TRACE_ISR_END();
+}
+
+/*******************************************************************************
+* Function Name: job_buffer_valid
+********************************************************************************
+* Summary:
+* Checks that a job buffer lies within the shared memory and is aligned for its
+* elements. The offsets come from the other core and are not trusted.
+*
+* Parameters:
+*  offset - buffer offset from the start of the shared memory
+*  len - buffer length in bytes
+*  align - required alignment in bytes, a power of two
+*
+* Return:
+*  bool - true if the buffer can be accessed
+*
+*******************************************************************************/
+static bool job_buffer_valid(uint32_t offset, uint32_t len, uint32_t align)
+{
+    return (offset <= sizeof(ipc_shared_t)) && (len <= (sizeof(ipc_shared_t) - offset)) &&
+           (0UL == (offset & (align - 1UL)));
+}
+
+/*******************************************************************************
+* Function Name: run_job
+********************************************************************************
+* Summary:
+* Runs one job of the ring. Inputs are fetched from and outputs published to
+* the shared memory, past the CM55 data cache. A job with an unknown operation
+* or with buffers outside the shared memory is not run.
+*
+* Parameters:
+*  job - job
+*  arg - unused
+*
+* Return:
+*  uint32_t - IPC_JOB_STATUS_*
+*
+*******************************************************************************/
+static uint32_t run_job(const job_ring_job_t* job, void* arg)
+{
+    uint32_t status = IPC_JOB_STATUS_BAD_JOB;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    TRACE_BEGIN(TRACE_EV_JOB, job->seq);
+
+    if ((IPC_JOB_OP_ENERGY == job->op) && (sizeof(uint64_t) == job->out_len) &&
+        job_buffer_valid(job->in, job->in_len, sizeof(int16_t)) &&
+        job_buffer_valid(job->out, job->out_len, sizeof(uint64_t)))
+    {
+        const int16_t* samples = (const int16_t*)IPC_SHARED_PTR(job->in);
+        uint64_t* energy = (uint64_t*)IPC_SHARED_PTR(job->out);
+        uint64_t sum = 0ULL;
+
+        ipc_shared_fetch(IPC_SHARED_PTR(job->in), job->in_len);
+
+        for (uint32_t i = 0U; i < (job->in_len / sizeof(int16_t)); i++)
+        {
+            sum += (uint64_t)((int32_t)samples[i] * samples[i]);
+        }
+
+        *energy = sum;
+        ipc_shared_publish(energy, sizeof(*energy));
+
+        status = IPC_JOB_STATUS_OK;
+    }
+
+    TRACE_END(TRACE_EV_JOB, job->seq);
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: vote_performance
+********************************************************************************
+* Summary:
+* Votes for the minimum performance level the CM55 needs. The CM33 runs the
+* system at the highest level voted for by any of its clients.
+*
+* Parameters:
+*  level - IPC_VOTE_LEVEL_* or IPC_VOTE_NONE to withdraw the vote
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void vote_performance(uint32_t level)
+{
+    IPC_SHARED->cm55_vote.level = level;
+    ipc_shared_publish(&IPC_SHARED->cm55_vote, sizeof(IPC_SHARED->cm55_vote));
+    ipc_doorbell_ring(IPC_DOORBELL_CM33);
+}
 
 /*******************************************************************************
 * Function Name: main
@@ -48,7 +184,10 @@
 * This is the main function for CM55 application. 
 * 
 * CM33 application enables the CM55 CPU and then the CM55 CPU enters 
-* deep sleep.
+* deep sleep. The CM33 queues compute jobs in the shared job ring and rings
+* the doorbell once per batch; the CM55 wakes, runs every queued job, rings
+* the CM33 doorbell to report the completion and returns to deep sleep. It
+* does not hold the system at any performance level.
 * 
 * Parameters:
 *  void
@@ -76,13 +215,41 @@ int main(void)
         while(true);
     }
 
+    /* Start the CM55 event trace, a no-op unless TRACE_TIMELINE is set */
+    TRACE_INIT();
+
     /* Enable global interrupts. */
     __enable_irq();
 
-    /* Put the CPU to Deep Sleep. */
+    job_ring_consumer_init(&job_consumer, &IPC_SHARED->jobs, ipc_shared_publish, ipc_shared_fetch);
+    ipc_doorbell_init(IPC_DOORBELL_CM55, DOORBELL_IRQ_PRIORITY, doorbell_isr);
+
+    vote_performance(IPC_VOTE_NONE);
+
     for (;;)
     {
-        Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        uint32_t state;
+
+        if (doorbell_rung)
+        {
+            doorbell_rung = false;
+
+            if (0UL != job_ring_drain(&job_consumer, run_job, NULL))
+            {
+                ipc_doorbell_ring(IPC_DOORBELL_CM33);
+            }
+        }
+
+        /* Put the CPU to Deep Sleep. A doorbell rung after the check stays
+         * pending and ends the Deep Sleep entry at once. */
+        state = Cy_SysLib_EnterCriticalSection();
+        if (!doorbell_rung)
+        {
+            TRACE_BEGIN(TRACE_EV_DEEP_SLEEP, 0UL);
+            Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+            TRACE_END(TRACE_EV_DEEP_SLEEP, 0UL);
+        }
+        Cy_SysLib_ExitCriticalSection(state);
     }
 }
 
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * File Name:   ipc_doorbell.c
+ *
+ * Description: This file contains the inter-core doorbells. A doorbell is a
+ *              notify event of one IPC channel routed to an IPC interrupt
+ *              structure of the receiving core. The IPC interrupts are Deep
+ *              Sleep capable, so a doorbell also wakes the receiving core.
+ *              The doorbell carries no data, the data is exchanged through
+ *              the shared memory (ipc_shared.h).
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "ipc_doorbell.h"
+#include "trace.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* IPC channel raising the notify events, shared by both doorbells */
+#define IPC_DOORBELL_CHAN           (CY_IPC_CHAN_USER)
+
+/* IPC interrupt structure of each doorbell */
+#define IPC_DOORBELL_INTR_CM33      (CY_IPC_INTR_USER)
+#define IPC_DOORBELL_INTR_CM55      (CY_IPC_INTR_USER + 1UL)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: intr_num
+********************************************************************************
+* Summary:
+* Returns the IPC interrupt structure of a doorbell.
+*
+* Parameters:
+*  bell - doorbell
+*
+* Return:
+*  uint32_t - IPC interrupt structure number
+*
+*******************************************************************************/
+static uint32_t intr_num(ipc_doorbell_t bell)
+{
+    return (IPC_DOORBELL_CM33 == bell) ? IPC_DOORBELL_INTR_CM33 : IPC_DOORBELL_INTR_CM55;
+}
+
+/*******************************************************************************
+* Function Name: ipc_doorbell_init
+********************************************************************************
+* Summary:
+* Enables a doorbell interrupt. Called by the core the doorbell interrupts.
+*
+* Parameters:
+*  bell - doorbell
+*  priority - interrupt priority
+*  handler - interrupt handler, must call ipc_doorbell_clear()
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void ipc_doorbell_init(ipc_doorbell_t bell, uint32_t priority, cy_israddress handler)
+{
+    uint32_t intr = intr_num(bell);
+    cy_stc_sysint_t doorbell_int_config =
+    {
+        .intrSrc = (IRQn_Type)CY_IPC_INTR_NUM_TO_VECT(intr),
+        .intrPriority = priority
+    };
+
+    Cy_IPC_Drv_SetInterruptMask(Cy_IPC_Drv_GetIntrBaseAddr(intr), 0UL, (1UL << IPC_DOORBELL_CHAN));
+    ipc_doorbell_clear(bell);
+
+    Cy_SysInt_Init(&doorbell_int_config, handler);
+    NVIC_ClearPendingIRQ(doorbell_int_config.intrSrc);
+    NVIC_EnableIRQ(doorbell_int_config.intrSrc);
+}
+
+/*******************************************************************************
+* Function Name: ipc_doorbell_ring
+********************************************************************************
+* Summary:
+* Interrupts the core of a doorbell. Data for the other core must be published
+* in the shared memory before.
+*
+* Parameters:
+*  bell - doorbell
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void ipc_doorbell_ring(ipc_doorbell_t bell)
+{
+    TRACE_INSTANT(TRACE_EV_IPC_RING, bell);
+    Cy_IPC_Drv_AcquireNotify(Cy_IPC_Drv_GetIpcBaseAddress(IPC_DOORBELL_CHAN), (1UL << intr_num(bell)));
+}
+
+/*******************************************************************************
+* Function Name: ipc_doorbell_clear
+********************************************************************************
+* Summary:
+* Acknowledges a doorbell.
+*
+* Parameters:
+*  bell - doorbell
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void ipc_doorbell_clear(ipc_doorbell_t bell)
+{
+    IPC_INTR_STRUCT_Type* intr = Cy_IPC_Drv_GetIntrBaseAddr(intr_num(bell));
+
+    Cy_IPC_Drv_ClearInterrupt(intr, 0UL, (1UL << IPC_DOORBELL_CHAN));
+
+    /* Read back so that the clear completes before the handler returns */
+    (void)Cy_IPC_Drv_GetInterruptStatusMasked(intr);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * File Name:   ipc_shared.h
+ *
+ * Description: This file describes the memory shared by the CM33 non-secure
+ *              and the CM55 applications. It is placed at the start of the
+ *              m33_m55_shared region of the device configuration.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _IPC_SHARED_H_
+#define _IPC_SHARED_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "job_ring.h"
+#include "trace_buf.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Each core reaches the shared region through its own memory map */
+#if defined(COMPONENT_CM55)
+#define IPC_SHARED_BASE             (CYMEM_CM55_0_m33_m55_shared_START)
+#else
+#define IPC_SHARED_BASE             (CYMEM_CM33_0_m33_m55_shared_START)
+#endif
+
+/* Shared structures are aligned to the CM55 data cache line, so that cleaning
+ * or invalidating one structure does not touch its neighbours */
+#define IPC_SHARED_CACHE_LINE       (32U)
+
+/* Performance levels voted for through the mailbox. The values match
+ * dvfs_level_t of the CM33 application. */
+#define IPC_VOTE_LEVEL_ULP          (0UL)
+#define IPC_VOTE_LEVEL_LP           (1UL)
+#define IPC_VOTE_LEVEL_HP           (2UL)
+#define IPC_VOTE_NONE               (0xFFFFFFFFUL)  /* No vote */
+
+/* Jobs run by the CM55, see job_ring.h */
+#define IPC_JOB_OP_ENERGY           (1UL)   /* Sum of squares of int16_t samples, uint64_t result */
+
+/* Job status set by the CM55 */
+#define IPC_JOB_STATUS_OK           (1UL)
+#define IPC_JOB_STATUS_BAD_JOB      (2UL)
+
+/* Size of the job data area */
+#define IPC_JOB_SAMPLES             (256U)
+
+/* Trace buffers, one per core */
+#define IPC_TRACE_CM33_S            (0U)
+#define IPC_TRACE_CM33_NS           (1U)
+#define IPC_TRACE_CM55              (2U)
+#define IPC_TRACE_CORES             (3U)
+
+/* Offset of a shared memory field, used to pass buffers in jobs */
+#define IPC_SHARED_OFFSET(field)    ((uint32_t)offsetof(ipc_shared_t, field))
+
+/* Address of a buffer passed in a job */
+#define IPC_SHARED_PTR(offset)      ((void*)(IPC_SHARED_BASE + (offset)))
+
+/* The shared memory */
+#define IPC_SHARED                  ((ipc_shared_t*)IPC_SHARED_BASE)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Performance level mailbox, written by the sending core only */
+typedef struct
+{
+    volatile uint32_t   level;      /* IPC_VOTE_LEVEL_* or IPC_VOTE_NONE */
+    uint32_t            reserved[(IPC_SHARED_CACHE_LINE / sizeof(uint32_t)) - 1U];
+} ipc_vote_mailbox_t;
+
+/* Layout of the shared region */
+typedef struct
+{
+    ipc_vote_mailbox_t  cm55_vote;  /* CM55 vote, read by the CM33 on the doorbell */
+    job_ring_t          jobs;       /* Jobs for the CM55 */
+    int16_t             job_samples[IPC_JOB_SAMPLES];   /* Job inputs, written by the CM33 */
+    uint64_t            job_results[JOB_RING_LEN];      /* Job outputs, written by the CM55 */
+    trace_buf_t         trace[IPC_TRACE_CORES];         /* Event traces, each written by its core only.
+                                                           Kept in every build so the layout matches. */
+} ipc_shared_t;
+
+/*******************************************************************************
+* Function Name: ipc_shared_publish
+********************************************************************************
+* Summary:
+* Makes data written by this core visible to the other core. Only the CM55 has
+* a data cache, on the CM33 this is a barrier.
+*
+* Parameters:
+*  addr - start of the data, aligned to IPC_SHARED_CACHE_LINE
+*  size - size of the data in bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+__STATIC_INLINE void ipc_shared_publish(volatile void* addr, uint32_t size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr(addr, (int32_t)size);
+#else
+    CY_UNUSED_PARAMETER(addr);
+    CY_UNUSED_PARAMETER(size);
+#endif
+    __DMB();
+}
+
+/*******************************************************************************
+* Function Name: ipc_shared_fetch
+********************************************************************************
+* Summary:
+* Discards any cached copy of data written by the other core before reading
+* it.
+*
+* Parameters:
+*  addr - start of the data, aligned to IPC_SHARED_CACHE_LINE
+*  size - size of the data in bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+__STATIC_INLINE void ipc_shared_fetch(volatile void* addr, uint32_t size)
+{
+    __DMB();
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr(addr, (int32_t)size);
+#else
+    CY_UNUSED_PARAMETER(addr);
+    CY_UNUSED_PARAMETER(size);
+#endif
+}
+
+#endif /* _IPC_SHARED_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,366 @@
+/*******************************************************************************
+ * File Name:   job_ring.c
+ *
+ * Description: This file contains the job ring between the CM33 non-secure
+ *              application, which queues compute jobs, and the CM55, which
+ *              runs them. Each index has a single writer, so no lock is
+ *              needed; memory barriers order the slot and index updates and
+ *              the sync callbacks keep the CM55 data cache coherent. The
+ *              producer batches jobs and asks for the doorbell only once
+ *              enough are queued, so that the CM55 wakes once per batch.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdatomic.h>
+
+#include "job_ring.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Orders the shared memory accesses of this core, a DMB on the device */
+#define BARRIER()       atomic_thread_fence(memory_order_seq_cst)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: ring_sync
+********************************************************************************
+* Summary:
+* Calls a sync callback if there is one.
+*
+* Parameters:
+*  fn - sync callback, can be NULL
+*  addr - start of the shared data
+*  size - size of the shared data in bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void ring_sync(job_ring_sync_t fn, volatile void* addr, uint32_t size)
+{
+    if (NULL != fn)
+    {
+        fn(addr, size);
+    }
+}
+
+/*******************************************************************************
+* Function Name: job_ring_init
+********************************************************************************
+* Summary:
+* Empties the ring and clears its statistics. Called by the producer before the
+* consumer is started.
+*
+* Parameters:
+*  ring - ring in shared memory
+*  publish - producer publish callback, can be NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void job_ring_init(job_ring_t* ring, job_ring_sync_t publish)
+{
+    ring->head = 0UL;
+    ring->tail = 0UL;
+    ring->wakes = 0UL;
+    ring->batches = 0UL;
+    ring->max_batch = 0UL;
+
+    ring_sync(publish, ring, (uint32_t)offsetof(job_ring_t, slots));
+    BARRIER();
+}
+
+/*******************************************************************************
+* Function Name: job_ring_producer_init
+********************************************************************************
+* Summary:
+* Initializes the producer side of a ring.
+*
+* Parameters:
+*  prod - producer
+*  ring - ring in shared memory
+*  batch - jobs queued before job_ring_push() asks for the doorbell, 1 to
+*          ring it for every job
+*  publish - makes written shared memory visible to the consumer, can be NULL
+*  fetch - discards stale shared memory before reading it, can be NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void job_ring_producer_init(job_ring_producer_t* prod, job_ring_t* ring, uint32_t batch,
+                            job_ring_sync_t publish, job_ring_sync_t fetch)
+{
+    prod->ring = ring;
+    prod->publish = publish;
+    prod->fetch = fetch;
+    prod->batch = (0UL != batch) ? batch : 1UL;
+    prod->unsignalled = 0UL;
+    prod->pushed = 0UL;
+    prod->rejected = 0UL;
+    prod->max_depth = 0UL;
+    prod->doorbells = 0UL;
+}
+
+/*******************************************************************************
+* Function Name: job_ring_push
+********************************************************************************
+* Summary:
+* Queues a job. The job is copied into its slot and made visible to the
+* consumer before the head is advanced.
+*
+* Parameters:
+*  prod - producer
+*  job - job to queue
+*  seq - returns the sequence number of the job, can be NULL
+*
+* Return:
+*  job_ring_status_t - JOB_RING_SIGNAL when the caller must ring the doorbell
+*
+*******************************************************************************/
+job_ring_status_t job_ring_push(job_ring_producer_t* prod, const job_ring_job_t* job, uint32_t* seq)
+{
+    job_ring_t* ring = prod->ring;
+    uint32_t head = ring->head;
+    uint32_t depth;
+    job_ring_job_t* slot;
+
+    ring_sync(prod->fetch, &ring->tail, sizeof(ring->tail));
+    depth = head - ring->tail;
+
+    if (depth >= JOB_RING_LEN)
+    {
+        prod->rejected++;
+        return JOB_RING_FULL;
+    }
+
+    slot = &ring->slots[head & (JOB_RING_LEN - 1U)];
+    *slot = *job;
+    slot->seq = head;
+    slot->status = 0UL;
+    ring_sync(prod->publish, slot, sizeof(*slot));
+
+    BARRIER();
+    ring->head = head + 1U;
+    ring_sync(prod->publish, &ring->head, sizeof(ring->head));
+
+    if (NULL != seq)
+    {
+        *seq = head;
+    }
+
+    prod->pushed++;
+    if ((depth + 1U) > prod->max_depth)
+    {
+        prod->max_depth = depth + 1U;
+    }
+
+    if (++prod->unsignalled < prod->batch)
+    {
+        return JOB_RING_QUEUED;
+    }
+
+    prod->unsignalled = 0UL;
+    prod->doorbells++;
+
+    return JOB_RING_SIGNAL;
+}
+
+/*******************************************************************************
+* Function Name: job_ring_flush
+********************************************************************************
+* Summary:
+* Ends an incomplete batch, so that queued jobs do not wait for the batch to
+* fill up.
+*
+* Parameters:
+*  prod - producer
+*
+* Return:
+*  bool - true when the caller must ring the doorbell
+*
+*******************************************************************************/
+bool job_ring_flush(job_ring_producer_t* prod)
+{
+    if (0UL == prod->unsignalled)
+    {
+        return false;
+    }
+
+    prod->unsignalled = 0UL;
+    prod->doorbells++;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: job_ring_done
+********************************************************************************
+* Summary:
+* Checks whether a job has run. The consumer publishes the outputs of a job
+* before it advances the tail past it.
+*
+* Parameters:
+*  prod - producer
+*  seq - sequence number returned by job_ring_push()
+*
+* Return:
+*  bool - true if the job has run
+*
+*******************************************************************************/
+bool job_ring_done(job_ring_producer_t* prod, uint32_t seq)
+{
+    job_ring_t* ring = prod->ring;
+    bool done;
+
+    ring_sync(prod->fetch, &ring->tail, sizeof(ring->tail));
+    done = ((int32_t)(ring->tail - seq) > 0);
+    BARRIER();
+
+    return done;
+}
+
+/*******************************************************************************
+* Function Name: job_ring_depth
+********************************************************************************
+* Summary:
+* Returns the number of jobs queued and not yet run.
+*
+* Parameters:
+*  prod - producer
+*
+* Return:
+*  uint32_t - queued jobs
+*
+*******************************************************************************/
+uint32_t job_ring_depth(job_ring_producer_t* prod)
+{
+    job_ring_t* ring = prod->ring;
+
+    ring_sync(prod->fetch, &ring->tail, sizeof(ring->tail));
+
+    return ring->head - ring->tail;
+}
+
+/*******************************************************************************
+* Function Name: job_ring_consumer_init
+********************************************************************************
+* Summary:
+* Initializes the consumer side of a ring.
+*
+* Parameters:
+*  cons - consumer
+*  ring - ring in shared memory
+*  publish - makes written shared memory visible to the producer, can be NULL
+*  fetch - discards stale shared memory before reading it, can be NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void job_ring_consumer_init(job_ring_consumer_t* cons, job_ring_t* ring,
+                            job_ring_sync_t publish, job_ring_sync_t fetch)
+{
+    cons->ring = ring;
+    cons->publish = publish;
+    cons->fetch = fetch;
+}
+
+/*******************************************************************************
+* Function Name: job_ring_drain
+********************************************************************************
+* Summary:
+* Runs the queued jobs until the ring is empty, including jobs queued while
+* draining. Called by the consumer after a doorbell.
+*
+* Parameters:
+*  cons - consumer
+*  handler - runs a job and returns its status, must publish the job outputs
+*  arg - handler argument
+*
+* Return:
+*  uint32_t - number of jobs run
+*
+*******************************************************************************/
+uint32_t job_ring_drain(job_ring_consumer_t* cons, job_ring_handler_t handler, void* arg)
+{
+    job_ring_t* ring = cons->ring;
+    uint32_t tail = ring->tail;
+    uint32_t count = 0UL;
+
+    for (;;)
+    {
+        job_ring_job_t* slot;
+
+        ring_sync(cons->fetch, &ring->head, sizeof(ring->head));
+        if (tail == ring->head)
+        {
+            break;
+        }
+        BARRIER();
+
+        slot = &ring->slots[tail & (JOB_RING_LEN - 1U)];
+        ring_sync(cons->fetch, slot, sizeof(*slot));
+        slot->status = handler(slot, arg);
+        ring_sync(cons->publish, slot, sizeof(*slot));
+
+        BARRIER();
+        ring->tail = ++tail;
+        ring_sync(cons->publish, &ring->tail, sizeof(ring->tail));
+        count++;
+    }
+
+    ring->batches++;
+    if (0UL != count)
+    {
+        ring->wakes++;
+        if (count > ring->max_batch)
+        {
+            ring->max_batch = count;
+        }
+    }
+    ring_sync(cons->publish, &ring->tail, (uint32_t)(JOB_RING_LINE_WORDS * sizeof(uint32_t)));
+
+    return count;
+}
+
+/* [] END OF FILE */
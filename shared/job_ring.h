@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * File Name:   job_ring.h
+ *
+ * Description: This file is the public interface of job_ring.c, the single
+ *              producer, single consumer job ring shared by the CM33
+ *              non-secure and the CM55 applications.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _JOB_RING_H_
+#define _JOB_RING_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The ring only depends on the C library so it can be tested on the host with
+ * a producer and a consumer thread */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of slots, must be a power of two */
+#define JOB_RING_LEN            (16U)
+
+/* Words in a cache line of the CM55 data cache */
+#define JOB_RING_LINE_WORDS     (8U)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Job, one cache line. Buffers are given as offsets from the start of the
+ * shared memory because each core maps it at its own address. */
+typedef struct
+{
+    uint32_t    op;             /* Application defined operation */
+    uint32_t    seq;            /* Set by job_ring_push() */
+    uint32_t    in;             /* Input buffer offset */
+    uint32_t    in_len;         /* Input length in bytes */
+    uint32_t    out;            /* Output buffer offset */
+    uint32_t    out_len;        /* Output length in bytes */
+    uint32_t    status;         /* Set by the consumer */
+    uint32_t    reserved;
+} job_ring_job_t;
+
+/* Ring in shared memory. The producer and the consumer each write their own
+ * cache line only. */
+typedef struct
+{
+    volatile uint32_t   head;       /* Next slot to fill, written by the producer */
+    uint32_t            producer_reserved[JOB_RING_LINE_WORDS - 1U];
+
+    volatile uint32_t   tail;       /* Next slot to run, written by the consumer */
+    volatile uint32_t   wakes;      /* Doorbells that found work */
+    volatile uint32_t   batches;    /* Drain passes */
+    volatile uint32_t   max_batch;  /* Most jobs run in one wake */
+    uint32_t            consumer_reserved[JOB_RING_LINE_WORDS - 4U];
+
+    job_ring_job_t      slots[JOB_RING_LEN];
+} job_ring_t;
+
+/* Makes written shared memory visible to the other core, or discards a stale
+ * copy before reading it. NULL on cache-coherent memory. */
+typedef void (*job_ring_sync_t)(volatile void* addr, uint32_t size);
+
+/* Runs a job, called by job_ring_drain() */
+typedef uint32_t (*job_ring_handler_t)(const job_ring_job_t* job, void* arg);
+
+/* Result of job_ring_push() */
+typedef enum
+{
+    JOB_RING_QUEUED = 0U,       /* Queued, the batch is not complete yet */
+    JOB_RING_SIGNAL,            /* Queued, ring the doorbell now */
+    JOB_RING_FULL               /* Not queued */
+} job_ring_status_t;
+
+/* Producer side, in the memory of the producer */
+typedef struct
+{
+    job_ring_t*         ring;
+    job_ring_sync_t     publish;
+    job_ring_sync_t     fetch;
+    uint32_t            batch;      /* Jobs queued before the doorbell is rung */
+    uint32_t            unsignalled;/* Jobs queued since the last doorbell */
+    uint32_t            pushed;     /* Jobs queued */
+    uint32_t            rejected;   /* Jobs refused on a full ring */
+    uint32_t            max_depth;  /* Most jobs seen queued */
+    uint32_t            doorbells;  /* Doorbells requested */
+} job_ring_producer_t;
+
+/* Consumer side, in the memory of the consumer */
+typedef struct
+{
+    job_ring_t*         ring;
+    job_ring_sync_t     publish;
+    job_ring_sync_t     fetch;
+} job_ring_consumer_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void job_ring_init(job_ring_t* ring, job_ring_sync_t publish);
+void job_ring_producer_init(job_ring_producer_t* prod, job_ring_t* ring, uint32_t batch,
+                            job_ring_sync_t publish, job_ring_sync_t fetch);
+job_ring_status_t job_ring_push(job_ring_producer_t* prod, const job_ring_job_t* job, uint32_t* seq);
+bool job_ring_flush(job_ring_producer_t* prod);
+bool job_ring_done(job_ring_producer_t* prod, uint32_t seq);
+uint32_t job_ring_depth(job_ring_producer_t* prod);
+void job_ring_consumer_init(job_ring_consumer_t* cons, job_ring_t* ring,
+                            job_ring_sync_t publish, job_ring_sync_t fetch);
+uint32_t job_ring_drain(job_ring_consumer_t* cons, job_ring_handler_t handler, void* arg);
+
+#endif /* _JOB_RING_H_ */
+
+/* [] END OF FILE */
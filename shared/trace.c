@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * File Name:   trace.c
+ *
+ * Description: This file connects the trace buffer of the running core to the
+ *              shared memory and the shared time base. It is built into the
+ *              CM33 secure, CM33 non-secure and CM55 applications, each of
+ *              which writes its own buffer.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "ipc_shared.h"
+#include "trace.h"
+
+#if defined(TRACE_TIMELINE)
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Buffer of the running core */
+#if defined(COMPONENT_SECURE_DEVICE)
+#define TRACE_CORE                  (IPC_TRACE_CM33_S)
+#elif defined(COMPONENT_CM55)
+#define TRACE_CORE                  (IPC_TRACE_CM55)
+#else
+#define TRACE_CORE                  (IPC_TRACE_CM33_NS)
+#endif
+
+/* All cores timestamp with the CM33 LPTimer, the only counter that runs at
+ * the same rate in every power mode. It is started by the CM33 non-secure
+ * event scheduler. */
+#define TRACE_CLOCK_HZ              (32768UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static trace_buf_writer_t trace_writer;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: trace_clock
+********************************************************************************
+* Summary:
+* Returns the shared time base, the cascaded counters of the CM33 LPTimer.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - time base ticks
+*
+*******************************************************************************/
+static uint32_t trace_clock(void)
+{
+    return Cy_MCWDT_GetCountCascaded(CYBSP_CM33_LPTIMER_0_HW);
+}
+
+/*******************************************************************************
+* Function Name: trace_init
+********************************************************************************
+* Summary:
+* Empties the buffer of the running core in the shared memory. Called once at
+* start-up, events traced before are dropped.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void trace_init(void)
+{
+    /* Only the CM55 has a data cache that must be cleaned for the host */
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    trace_buf_sync_t publish = ipc_shared_publish;
+#else
+    trace_buf_sync_t publish = NULL;
+#endif
+
+    trace_buf_init(&trace_writer, &IPC_SHARED->trace[TRACE_CORE], TRACE_CORE, TRACE_CLOCK_HZ,
+                   trace_clock, publish);
+}
+
+/*******************************************************************************
+* Function Name: trace_emit
+********************************************************************************
+* Summary:
+* Records an event of the running core. Use the TRACE_* macros instead, they
+* compile to nothing when tracing is off.
+*
+* Parameters:
+*  event - event
+*  phase - TRACE_PHASE_*
+*  arg - event argument
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void trace_emit(trace_event_t event, uint32_t phase, uint32_t arg)
+{
+    trace_buf_emit(&trace_writer, (uint32_t)event, phase, arg);
+}
+
+#endif /* defined(TRACE_TIMELINE) */
+
+/* [] END OF FILE */
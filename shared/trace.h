@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * File Name:   trace.h
+ *
+ * Description: This file is the public interface of trace.c, the event trace
+ *              of the CM33 secure, CM33 non-secure and CM55 applications. The
+ *              TRACE_* macros compile to nothing unless TRACE_TIMELINE is
+ *              defined.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cybsp.h"
+#include "trace_buf.h"
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Events, in dictionary order */
+typedef enum
+{
+#define TRACE_EVENT(name, label, arg) TRACE_EV_##name,
+#include "trace_events.def"
+#undef TRACE_EVENT
+    TRACE_EV_MAX
+} trace_event_t;
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#if defined(TRACE_TIMELINE)
+
+#define TRACE_INIT()                trace_init()
+#define TRACE_BEGIN(event, arg)     trace_emit((event), TRACE_PHASE_BEGIN, (uint32_t)(arg))
+#define TRACE_END(event, arg)       trace_emit((event), TRACE_PHASE_END, (uint32_t)(arg))
+#define TRACE_INSTANT(event, arg)   trace_emit((event), TRACE_PHASE_INSTANT, (uint32_t)(arg))
+
+/* Interrupt handler entry and exit, by the IRQ number of the active exception */
+#define TRACE_ISR_BEGIN()           TRACE_BEGIN(TRACE_EV_ISR, __get_IPSR() - 16UL)
+#define TRACE_ISR_END()             TRACE_END(TRACE_EV_ISR, __get_IPSR() - 16UL)
+
+#else
+
+#define TRACE_INIT()                do { } while (0)
+#define TRACE_BEGIN(event, arg)     do { } while (0)
+#define TRACE_END(event, arg)       do { } while (0)
+#define TRACE_INSTANT(event, arg)   do { } while (0)
+#define TRACE_ISR_BEGIN()           do { } while (0)
+#define TRACE_ISR_END()             do { } while (0)
+
+#endif /* defined(TRACE_TIMELINE) */
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+#if defined(TRACE_TIMELINE)
+void trace_init(void);
+void trace_emit(trace_event_t event, uint32_t phase, uint32_t arg);
+#endif /* defined(TRACE_TIMELINE) */
+
+#endif /* _TRACE_H_ */
+
+/* [] END OF FILE */
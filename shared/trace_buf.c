@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * File Name:   trace_buf.c
+ *
+ * Description: This file contains the per-core event trace buffer. Every
+ *              record carries a timestamp of a time base shared by all cores,
+ *              so the buffers of the cores can be merged into one timeline on
+ *              the host.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdatomic.h>
+
+#include "trace_buf.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Orders the memory accesses of this core, a DMB on the device */
+#define BARRIER()       atomic_thread_fence(memory_order_seq_cst)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: trace_buf_init
+********************************************************************************
+* Summary:
+* Empties a buffer and publishes its header. Records written before are lost.
+*
+* Parameters:
+*  writer - writer of this core
+*  buf - buffer of this core
+*  core - core number stored in the header
+*  hz - time base frequency stored in the header
+*  clock - time base
+*  publish - makes written memory visible to the host, can be NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void trace_buf_init(trace_buf_writer_t* writer, trace_buf_t* buf, uint32_t core, uint32_t hz,
+                    trace_buf_clock_t clock, trace_buf_sync_t publish)
+{
+    writer->buf = buf;
+    writer->clock = clock;
+    writer->publish = publish;
+
+    buf->magic = 0UL;
+    BARRIER();
+
+    buf->version = TRACE_BUF_VERSION;
+    buf->core = core;
+    buf->hz = hz;
+    buf->records = TRACE_BUF_RECORDS;
+    buf->head = 0UL;
+    buf->reserved[0] = 0UL;
+    buf->reserved[1] = 0UL;
+
+    for (uint32_t i = 0U; i < TRACE_BUF_RECORDS; i++)
+    {
+        /* No record has this number before the buffer wraps around */
+        buf->recs[i].seq = ~i;
+    }
+
+    if (NULL != publish)
+    {
+        publish(buf, (uint32_t)sizeof(*buf));
+    }
+
+    BARRIER();
+    buf->magic = TRACE_BUF_MAGIC;
+
+    if (NULL != publish)
+    {
+        publish(buf, (uint32_t)offsetof(trace_buf_t, recs));
+    }
+}
+
+/*******************************************************************************
+* Function Name: trace_buf_emit
+********************************************************************************
+* Summary:
+* Appends a record. Can be called from interrupts: a record slot is reserved
+* with an atomic increment of the head, so an interrupt that preempts a record
+* write reserves the next slot. The record number is written last, records
+* caught in the middle of a write do not match their slot and are skipped by
+* the host tool.
+*
+* Parameters:
+*  writer - writer of this core
+*  event - event
+*  phase - TRACE_PHASE_*
+*  arg - event argument
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void trace_buf_emit(trace_buf_writer_t* writer, uint32_t event, uint32_t phase, uint32_t arg)
+{
+    trace_buf_t* buf = writer->buf;
+    trace_rec_t* rec;
+    uint32_t seq;
+
+    if (NULL == buf)
+    {
+        return;
+    }
+
+    seq = atomic_fetch_add_explicit((volatile _Atomic uint32_t*)&buf->head, 1UL, memory_order_relaxed);
+    rec = &buf->recs[seq & (TRACE_BUF_RECORDS - 1U)];
+
+    rec->ts = writer->clock();
+    rec->event = (uint16_t)event;
+    rec->phase = (uint16_t)phase;
+    rec->arg = arg;
+    BARRIER();
+    rec->seq = seq;
+
+    if (NULL != writer->publish)
+    {
+        writer->publish(rec, (uint32_t)sizeof(*rec));
+    }
+}
+
+/* [] END OF FILE */
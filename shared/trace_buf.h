@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * File Name:   trace_buf.h
+ *
+ * Description: This file is the public interface of trace_buf.c, the per-core
+ *              event trace buffer written by the CM33 secure, CM33 non-secure
+ *              and CM55 applications on a shared time base.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _TRACE_BUF_H_
+#define _TRACE_BUF_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+/* The buffer only depends on the C library so it can be built on the host */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Records of a buffer, must be a power of two. The oldest are overwritten. */
+#define TRACE_BUF_RECORDS       (256U)
+
+/* Identifies an initialized buffer, the host tool searches memory dumps for it */
+#define TRACE_BUF_MAGIC         (0x54524342UL)
+
+/* Layout version of trace_buf_t and trace_rec_t */
+#define TRACE_BUF_VERSION       (1UL)
+
+/* Record phases */
+#define TRACE_PHASE_BEGIN       (0U)    /* Start of a duration */
+#define TRACE_PHASE_END         (1U)    /* End of the last duration of the event */
+#define TRACE_PHASE_INSTANT     (2U)    /* Point in time */
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Event record, half a CM55 cache line */
+typedef struct
+{
+    uint32_t    seq;            /* Record number, written last */
+    uint32_t    ts;             /* Time base ticks */
+    uint16_t    event;          /* Application defined event */
+    uint16_t    phase;          /* TRACE_PHASE_* */
+    uint32_t    arg;            /* Event argument */
+} trace_rec_t;
+
+/* Buffer of one core, written by that core only. The header fills one cache
+ * line. */
+typedef struct
+{
+    volatile uint32_t   magic;      /* TRACE_BUF_MAGIC once initialized */
+    uint32_t            version;    /* TRACE_BUF_VERSION */
+    uint32_t            core;       /* Application defined core number */
+    uint32_t            hz;         /* Time base frequency */
+    uint32_t            records;    /* TRACE_BUF_RECORDS */
+    volatile uint32_t   head;       /* Records reserved so far */
+    uint32_t            reserved[2];
+
+    trace_rec_t         recs[TRACE_BUF_RECORDS];
+} trace_buf_t;
+
+/* Returns the time base count */
+typedef uint32_t (*trace_buf_clock_t)(void);
+
+/* Makes written memory visible to other bus masters, NULL on memory that is
+ * not cached */
+typedef void (*trace_buf_sync_t)(volatile void* addr, uint32_t size);
+
+/* Writer, in the memory of the writing core */
+typedef struct
+{
+    trace_buf_t*        buf;
+    trace_buf_clock_t   clock;
+    trace_buf_sync_t    publish;
+} trace_buf_writer_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void trace_buf_init(trace_buf_writer_t* writer, trace_buf_t* buf, uint32_t core, uint32_t hz,
+                    trace_buf_clock_t clock, trace_buf_sync_t publish);
+void trace_buf_emit(trace_buf_writer_t* writer, uint32_t event, uint32_t phase, uint32_t arg);
+
+#endif /* _TRACE_BUF_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,374 @@
+/*******************************************************************************
+ * File Name:   main.c
+ *
+ * Description: This file contains the host test of the DVFS governor in
+ *              proj_cm33_ns/dvfs_governor.c. Each policy is fed synthetic
+ *              load traces and the level after every window is checked,
+ *              including the hysteresis between down_pct and up_pct, the
+ *              down_windows delay and the min_interval_ms rate limit.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dvfs_governor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define HARNESS_UP_PCT              (80UL)
+#define HARNESS_DOWN_PCT            (30UL)
+#define HARNESS_DOWN_WINDOWS        (3UL)
+#define HARNESS_MIN_INTERVAL_MS     (100UL)
+
+/* Windows of a trace are this far apart unless the trace tests the rate limit,
+ * so that the rate limit never holds a change back */
+#define HARNESS_WINDOW_MS           (HARNESS_MIN_INTERVAL_MS)
+
+#define HARNESS_STEPS(steps)        ((uint32_t)(sizeof(steps) / sizeof((steps)[0])))
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* One window of a load trace and the level expected after it */
+typedef struct
+{
+    uint32_t        now_ms;         /* End of the window */
+    uint32_t        load_pct;       /* Busy share of the window */
+    dvfs_level_t    level;          /* Expected level */
+} harness_step_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static const char* const harness_level_names[DVFS_LEVEL_MAX] = { "ULP", "LP", "HP" };
+
+static const dvfs_governor_cfg_t harness_cfg =
+{
+    .up_pct = HARNESS_UP_PCT,
+    .down_pct = HARNESS_DOWN_PCT,
+    .down_windows = HARNESS_DOWN_WINDOWS,
+    .min_interval_ms = HARNESS_MIN_INTERVAL_MS
+};
+
+/* Ondemand jumps to HP at up_pct, keeps the level for loads from down_pct up
+ * to up_pct, and steps down one level after down_windows low windows in a
+ * row. A load that is not low restarts the count. */
+static const harness_step_t harness_ondemand[] =
+{
+    {  1U * HARNESS_WINDOW_MS, 79UL, DVFS_LEVEL_ULP },
+    {  2U * HARNESS_WINDOW_MS, 80UL, DVFS_LEVEL_HP },
+    {  3U * HARNESS_WINDOW_MS, 50UL, DVFS_LEVEL_HP },
+    {  4U * HARNESS_WINDOW_MS, 79UL, DVFS_LEVEL_HP },
+    {  5U * HARNESS_WINDOW_MS, 30UL, DVFS_LEVEL_HP },
+    {  6U * HARNESS_WINDOW_MS, 29UL, DVFS_LEVEL_HP },
+    {  7U * HARNESS_WINDOW_MS, 29UL, DVFS_LEVEL_HP },
+    {  8U * HARNESS_WINDOW_MS, 30UL, DVFS_LEVEL_HP },
+    {  9U * HARNESS_WINDOW_MS, 29UL, DVFS_LEVEL_HP },
+    { 10U * HARNESS_WINDOW_MS, 29UL, DVFS_LEVEL_HP },
+    { 11U * HARNESS_WINDOW_MS, 29UL, DVFS_LEVEL_LP },
+    { 12U * HARNESS_WINDOW_MS,  0UL, DVFS_LEVEL_LP },
+    { 13U * HARNESS_WINDOW_MS,  0UL, DVFS_LEVEL_LP },
+    { 14U * HARNESS_WINDOW_MS,  0UL, DVFS_LEVEL_ULP },
+    { 15U * HARNESS_WINDOW_MS,  0UL, DVFS_LEVEL_ULP },
+    { 16U * HARNESS_WINDOW_MS,  0UL, DVFS_LEVEL_ULP },
+    { 17U * HARNESS_WINDOW_MS,  0UL, DVFS_LEVEL_ULP },
+    { 18U * HARNESS_WINDOW_MS, 100UL, DVFS_LEVEL_HP }
+};
+
+/* Conservative steps one level at a time in both directions */
+static const harness_step_t harness_conservative[] =
+{
+    {  1U * HARNESS_WINDOW_MS, 80UL, DVFS_LEVEL_LP },
+    {  2U * HARNESS_WINDOW_MS, 90UL, DVFS_LEVEL_HP },
+    {  3U * HARNESS_WINDOW_MS, 100UL, DVFS_LEVEL_HP },
+    {  4U * HARNESS_WINDOW_MS, 79UL, DVFS_LEVEL_HP },
+    {  5U * HARNESS_WINDOW_MS, 10UL, DVFS_LEVEL_HP },
+    {  6U * HARNESS_WINDOW_MS, 10UL, DVFS_LEVEL_HP },
+    {  7U * HARNESS_WINDOW_MS, 10UL, DVFS_LEVEL_LP },
+    {  8U * HARNESS_WINDOW_MS, 10UL, DVFS_LEVEL_LP },
+    {  9U * HARNESS_WINDOW_MS, 50UL, DVFS_LEVEL_LP },
+    { 10U * HARNESS_WINDOW_MS, 10UL, DVFS_LEVEL_LP },
+    { 11U * HARNESS_WINDOW_MS, 10UL, DVFS_LEVEL_LP },
+    { 12U * HARNESS_WINDOW_MS, 10UL, DVFS_LEVEL_ULP },
+    { 13U * HARNESS_WINDOW_MS, 10UL, DVFS_LEVEL_ULP },
+    { 14U * HARNESS_WINDOW_MS, 10UL, DVFS_LEVEL_ULP },
+    { 15U * HARNESS_WINDOW_MS, 10UL, DVFS_LEVEL_ULP },
+    { 16U * HARNESS_WINDOW_MS, 95UL, DVFS_LEVEL_LP }
+};
+
+/* Race-to-idle runs any load from down_pct up in HP, and drops straight to
+ * ULP after down_windows low windows */
+static const harness_step_t harness_race_to_idle[] =
+{
+    {  1U * HARNESS_WINDOW_MS, 29UL, DVFS_LEVEL_ULP },
+    {  2U * HARNESS_WINDOW_MS, 30UL, DVFS_LEVEL_HP },
+    {  3U * HARNESS_WINDOW_MS, 29UL, DVFS_LEVEL_HP },
+    {  4U * HARNESS_WINDOW_MS, 29UL, DVFS_LEVEL_HP },
+    {  5U * HARNESS_WINDOW_MS, 31UL, DVFS_LEVEL_HP },
+    {  6U * HARNESS_WINDOW_MS, 29UL, DVFS_LEVEL_HP },
+    {  7U * HARNESS_WINDOW_MS, 29UL, DVFS_LEVEL_HP },
+    {  8U * HARNESS_WINDOW_MS, 29UL, DVFS_LEVEL_ULP },
+    {  9U * HARNESS_WINDOW_MS,  0UL, DVFS_LEVEL_ULP },
+    { 10U * HARNESS_WINDOW_MS, 60UL, DVFS_LEVEL_HP }
+};
+
+/* A change is held back until min_interval_ms passed since the previous one,
+ * windows are 40 ms apart. Ondemand with one low window to step down. */
+static const harness_step_t harness_rate_limit[] =
+{
+    {  40UL, 90UL, DVFS_LEVEL_ULP },
+    {  80UL, 90UL, DVFS_LEVEL_ULP },
+    { 120UL, 90UL, DVFS_LEVEL_HP },
+    { 160UL,  0UL, DVFS_LEVEL_HP },
+    { 200UL,  0UL, DVFS_LEVEL_HP },
+    { 240UL,  0UL, DVFS_LEVEL_LP },
+    { 280UL, 90UL, DVFS_LEVEL_LP },
+    { 320UL, 90UL, DVFS_LEVEL_LP },
+    { 340UL, 90UL, DVFS_LEVEL_HP }
+};
+
+static uint32_t harness_failures = 0UL;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: harness_check
+********************************************************************************
+* Summary:
+*  Records a failed check.
+*
+* Parameters:
+*  ok - result of the check
+*  what - description of the check
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_check(bool ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+
+    if (!ok)
+    {
+        harness_failures++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_trace
+********************************************************************************
+* Summary:
+*  Feeds a load trace to a new governor that starts in ULP at time 0, and
+*  checks the level after every window and the number of level changes.
+*
+* Parameters:
+*  what - description of the trace
+*  policy - policy
+*  cfg - tuning
+*  steps - trace
+*  count - windows in the trace
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_trace(const char* what, const dvfs_policy_t* policy, const dvfs_governor_cfg_t* cfg,
+                          const harness_step_t* steps, uint32_t count)
+{
+    dvfs_governor_t gov;
+    dvfs_level_t prev = DVFS_LEVEL_ULP;
+    uint32_t changes = 0UL;
+    bool ok = true;
+
+    dvfs_governor_init(&gov, policy, cfg, DVFS_LEVEL_ULP, 0UL);
+
+    for (uint32_t i = 0UL; i < count; i++)
+    {
+        dvfs_level_t level = dvfs_governor_sample(&gov, steps[i].load_pct, 100UL - steps[i].load_pct,
+                                                  steps[i].now_ms);
+
+        if ((level != steps[i].level) && ok)
+        {
+            printf("  %lu ms, load %lu%%: %s, expected %s\n", (unsigned long)steps[i].now_ms,
+                   (unsigned long)steps[i].load_pct, harness_level_names[level],
+                   harness_level_names[steps[i].level]);
+            ok = false;
+        }
+
+        changes += (steps[i].level != prev) ? 1UL : 0UL;
+        prev = steps[i].level;
+    }
+
+    harness_check(ok && (changes == gov.changes), what);
+}
+
+/*******************************************************************************
+* Function Name: harness_load_test
+********************************************************************************
+* Summary:
+*  Checks the load computation at its limits.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_load_test(void)
+{
+    dvfs_governor_t gov;
+
+    dvfs_governor_init(&gov, &dvfs_policy_ondemand, &harness_cfg, DVFS_LEVEL_ULP, 0UL);
+
+    (void)dvfs_governor_sample(&gov, 0UL, 0UL, HARNESS_WINDOW_MS);
+    harness_check((0UL == gov.load_pct) && (DVFS_LEVEL_ULP == gov.level), "an empty window is no load");
+
+    (void)dvfs_governor_sample(&gov, UINT32_MAX, 0UL, 2U * HARNESS_WINDOW_MS);
+    harness_check(100UL == gov.load_pct, "a fully busy window does not overflow");
+
+    (void)dvfs_governor_sample(&gov, UINT32_MAX, UINT32_MAX, 3U * HARNESS_WINDOW_MS);
+    harness_check(50UL == gov.load_pct, "large busy and idle times do not overflow");
+}
+
+/*******************************************************************************
+* Function Name: harness_wrap_test
+********************************************************************************
+* Summary:
+*  Checks the rate limit across the wrap of the millisecond time.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_wrap_test(void)
+{
+    dvfs_governor_t gov;
+    uint32_t start = UINT32_MAX - 50UL;
+
+    dvfs_governor_init(&gov, &dvfs_policy_ondemand, &harness_cfg, DVFS_LEVEL_ULP, start);
+
+    harness_check(DVFS_LEVEL_ULP == dvfs_governor_sample(&gov, 90UL, 10UL, start + 60UL),
+                  "the rate limit holds across the time wrap");
+    harness_check(DVFS_LEVEL_HP == dvfs_governor_sample(&gov, 90UL, 10UL, start + HARNESS_MIN_INTERVAL_MS),
+                  "the rate limit expires across the time wrap");
+}
+
+/*******************************************************************************
+* Function Name: harness_policy_switch_test
+********************************************************************************
+* Summary:
+*  Checks that a policy switch keeps the level and restarts the count of low
+*  windows.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_policy_switch_test(void)
+{
+    dvfs_governor_t gov;
+    uint32_t now = 0UL;
+
+    dvfs_governor_init(&gov, &dvfs_policy_ondemand, &harness_cfg, DVFS_LEVEL_HP, now);
+
+    for (uint32_t i = 0UL; i < (HARNESS_DOWN_WINDOWS - 1UL); i++)
+    {
+        now += HARNESS_WINDOW_MS;
+        (void)dvfs_governor_sample(&gov, 0UL, 100UL, now);
+    }
+
+    dvfs_governor_set_policy(&gov, &dvfs_policy_conservative);
+    harness_check(DVFS_LEVEL_HP == gov.level, "a policy switch keeps the level");
+
+    now += HARNESS_WINDOW_MS;
+    harness_check(DVFS_LEVEL_HP == dvfs_governor_sample(&gov, 0UL, 100UL, now),
+                  "a policy switch restarts the count of low windows");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs all checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int
+*
+*******************************************************************************/
+int main(void)
+{
+    dvfs_governor_cfg_t fast_down = harness_cfg;
+
+    fast_down.down_windows = 1UL;
+
+    harness_trace("ondemand levels, hysteresis and down_windows", &dvfs_policy_ondemand, &harness_cfg,
+                  harness_ondemand, HARNESS_STEPS(harness_ondemand));
+    harness_trace("conservative levels, hysteresis and down_windows", &dvfs_policy_conservative, &harness_cfg,
+                  harness_conservative, HARNESS_STEPS(harness_conservative));
+    harness_trace("race-to-idle levels, hysteresis and down_windows", &dvfs_policy_race_to_idle, &harness_cfg,
+                  harness_race_to_idle, HARNESS_STEPS(harness_race_to_idle));
+    harness_trace("min_interval_ms rate limit", &dvfs_policy_ondemand, &fast_down,
+                  harness_rate_limit, HARNESS_STEPS(harness_rate_limit));
+
+    harness_load_test();
+    harness_wrap_test();
+    harness_policy_switch_test();
+
+    printf("%lu failures\n", (unsigned long)harness_failures);
+
+    return (0UL == harness_failures) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
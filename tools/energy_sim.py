@@ -0,0 +1,448 @@
+#!/usr/bin/env python3
+################################################################################
+# \file energy_sim.py
+# \version 1.0
+#
+# \brief
+# Replays a recorded workload against a model of the power modes and reports
+# the charge, energy, and deadline misses every power policy would have
+# produced: the modes of the recording, HP, LP, or ULP fixed, and the
+# ondemand, conservative, and race-to-idle governors. The governors are the
+# ones of the firmware: proj_cm33_ns/dvfs_governor.c is compiled with the host
+# C compiler ($CC, cc by default) and called every governor window.
+#
+# Usage: energy_sim.py [options] <recording.txt | trace.json>
+#        -m, --model <model.json>   overrides of the default model, see MODEL
+#        -k, --kit <epc2|epc4>      kit whose currents are used (epc2)
+#        -p, --policies <a,b,...>   policies to run (all)
+#        -d, --deadline <ms>        deadline of work recorded without one
+#        --csv                      prints the results as CSV
+#        --strict                   exits with 2 if a policy missed a deadline
+#
+# A recording is a text file with one event per line, "#" starts a comment:
+#        <time_ms> work <cycles> [<deadline_ms>]    work released at time_ms
+#        <time_ms> mode hp|lp|ulp                   power mode of the recording
+#        <time_ms> end                              end of the recording
+# A Chrome trace JSON file written by trace_merge.py is converted: every busy
+# period of the CM33 non-secure image becomes work of the cycles it took in
+# the power mode of the time, and the mode switches are kept.
+#
+################################################################################
+# \copyright
+# (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import ctypes
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+# Levels of dvfs_level_t in proj_cm33_ns/dvfs_governor.h
+ULP, LP, HP = 0, 1, 2
+LEVELS = {"ulp": ULP, "lp": LP, "hp": HP}
+LEVEL_NAMES = ["ULP", "LP", "HP"]
+
+# cy_en_user_syspm_mode_t in user_srf/user_syspm_srf.h, as traced
+TRACE_MODES = {0: HP, 1: LP, 2: ULP}
+TRACE_CM33_NS = 1
+
+GOVERNOR_SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               "..", "proj_cm33_ns", "dvfs_governor.c")
+GOVERNORS = {"ondemand": "dvfs_policy_ondemand",
+             "conservative": "dvfs_policy_conservative",
+             "race-to-idle": "dvfs_policy_race_to_idle"}
+POLICIES = ["recorded", "hp", "lp", "ulp"] + list(GOVERNORS)
+
+# Default model. The currents of the active modes and Deep Sleep are the
+# placeholder RESIDENCY_CURRENT_UA of user_srf/user_syspm_srf.c, the clocks
+# are the DPLL_FREQ_* operating points of proj_cm33_s/main.c, and the
+# governor is configured like in proj_cm33_ns/main.c. The currents and the
+# latencies are estimates; replace them with measurements, for example with
+# the mode switch latencies of a SCENARIO_PLAYBACK run.
+MODEL = {
+    "supply_mv": 1800,
+    "hz": {"hp": 400000000, "lp": 120000000, "ulp": 50000000},
+    "active_ua": {
+        "epc2": {"hp": 18000, "lp": 6500, "ulp": 1900},
+        "epc4": {"hp": 19500, "lp": 7200, "ulp": 2100},
+    },
+    "sleep_ua": {
+        "epc2": {"hp": 7000, "lp": 2600, "ulp": 800},
+        "epc4": {"hp": 7600, "lp": 2900, "ulp": 900},
+    },
+    # A switch relocks the DPLL twice, at DPLL_FREQ_BEFORE_TRIM_* and at the
+    # operating point, and waits for the regulator. The core draws the current
+    # of the lower mode meanwhile. ULP is entered and left through LP.
+    "transition": {
+        "dpll_lock_us": 40,
+        "dpll_locks": 2,
+        "settle_us": {"hp-lp": 150, "lp-ulp": 200},
+    },
+    # Idle gaps of at least min_idle_ms are spent in Deep Sleep, like
+    # EVENT_SCHED_PORT_DS_MIN_TICKS. The firmware only hibernates on request,
+    # so hibernate is off unless min_idle_ms is set.
+    "deep_sleep": {
+        "ua": {"epc2": 28, "epc4": 36},
+        "min_idle_ms": 2,
+        "entry_us": 60,
+        "exit_us": 250,
+    },
+    "hibernate": {
+        "ua": {"epc2": 2, "epc4": 3},
+        "min_idle_ms": None,
+        "entry_us": 100,
+        "exit_us": 4000,
+    },
+    "governor": {
+        "window_ms": 100,
+        "up_pct": 80,
+        "down_pct": 30,
+        "down_windows": 3,
+        "min_interval_ms": 300,
+    },
+}
+
+
+class GovernorCfg(ctypes.Structure):
+    _fields_ = [("up_pct", ctypes.c_uint32), ("down_pct", ctypes.c_uint32),
+                ("down_windows", ctypes.c_uint32), ("min_interval_ms", ctypes.c_uint32)]
+
+
+class Governor(ctypes.Structure):
+    _fields_ = [("policy", ctypes.c_void_p), ("cfg", GovernorCfg), ("level", ctypes.c_int),
+                ("load_pct", ctypes.c_uint32), ("low_windows", ctypes.c_uint32),
+                ("last_change_ms", ctypes.c_uint32), ("changes", ctypes.c_uint32)]
+
+
+def load_governor(tmpdir):
+    """Builds the firmware governor as a shared library and loads it."""
+    lib = os.path.join(tmpdir, "dvfs_governor.so")
+    cc = os.environ.get("CC", "cc")
+    subprocess.check_call([cc, "-shared", "-fPIC", "-O2", "-o", lib, GOVERNOR_SOURCE])
+
+    gov = ctypes.CDLL(lib)
+    gov.dvfs_governor_init.argtypes = [ctypes.POINTER(Governor), ctypes.c_void_p,
+                                       ctypes.POINTER(GovernorCfg), ctypes.c_int, ctypes.c_uint32]
+    gov.dvfs_governor_sample.argtypes = [ctypes.POINTER(Governor), ctypes.c_uint32,
+                                         ctypes.c_uint32, ctypes.c_uint32]
+    gov.dvfs_governor_sample.restype = ctypes.c_int
+    return gov
+
+
+def merge_model(model, overrides):
+    for key, value in overrides.items():
+        if isinstance(value, dict) and isinstance(model.get(key), dict):
+            merge_model(model[key], value)
+        else:
+            model[key] = value
+    return model
+
+
+def kit_value(value, kit):
+    """Returns the value for the kit if it is given per kit."""
+    return value[kit] if isinstance(value, dict) and kit in value else value
+
+
+def read_recording(path, deadline_ms):
+    """Returns the work as (release_us, cycles, deadline_us or None), the
+    recorded modes as (time_us, level), and the end time in microseconds."""
+    work, modes = [], []
+    end = 0.0
+
+    with open(path, "r", encoding="utf-8") as f:
+        for num, line in enumerate(f, 1):
+            fields = line.split("#", 1)[0].split()
+            if not fields:
+                continue
+            try:
+                t = float(fields[0]) * 1000.0
+                if fields[1] == "work" and len(fields) in (3, 4):
+                    deadline = float(fields[3]) if len(fields) == 4 else deadline_ms
+                    work.append((t, int(fields[2]), None if deadline is None else deadline * 1000.0))
+                elif fields[1] == "mode" and len(fields) == 3:
+                    modes.append((t, LEVELS[fields[2].lower()]))
+                elif fields[1] != "end" or len(fields) != 2:
+                    raise ValueError
+            except (ValueError, IndexError, KeyError):
+                raise ValueError("%s:%d: bad event \"%s\"" % (path, num, line.strip()))
+            end = max(end, t)
+
+    return sorted(work), sorted(modes), end
+
+
+def read_trace(path, model, deadline_ms):
+    """Converts a trace_merge.py timeline into a recording."""
+    with open(path, "r", encoding="utf-8") as f:
+        events = [e for e in json.load(f)["traceEvents"] if "ts" in e]
+
+    hz = {LEVELS[name]: value for name, value in model["hz"].items()}
+    deadline = None if deadline_ms is None else deadline_ms * 1000.0
+    work, modes = [], []
+    level = HP
+    idle = 0
+    busy_from = None
+
+    for e in sorted(events, key=lambda e: e["ts"]):
+        if e["name"] == "Mode switch" and e["ph"] == "E":
+            level = TRACE_MODES.get(e.get("args", {}).get("mode"), level)
+            modes.append((e["ts"], level))
+        if e["tid"] != TRACE_CM33_NS:
+            continue
+        if busy_from is None:
+            busy_from = e["ts"]
+
+        # The time outside sleep and mode transitions is work
+        if e["name"] in ("CPU Sleep", "Deep Sleep", "Mode transition"):
+            if e["ph"] == "B":
+                if idle == 0 and e["ts"] > busy_from:
+                    work.append((busy_from, int((e["ts"] - busy_from) * hz[level] / 1e6), deadline))
+                idle += 1
+            elif e["ph"] == "E" and idle:
+                idle -= 1
+                if idle == 0:
+                    busy_from = e["ts"]
+
+    end = events[-1]["ts"] if events else 0.0
+    start = events[0]["ts"] if events else 0.0
+    if busy_from is not None and idle == 0 and end > busy_from:
+        work.append((busy_from, int((end - busy_from) * hz[level] / 1e6), deadline))
+    work = [(t - start, c, d) for t, c, d in work if c]
+    modes = [(t - start, lvl) for t, lvl in modes]
+    return work, modes, end - start
+
+
+class Simulator:
+    """Runs the work FIFO in one power mode at a time. The CPU idles between
+    the known events, the wake-up latency of an idle state delays the work."""
+
+    def __init__(self, model, kit):
+        self.supply_mv = model["supply_mv"]
+        self.hz = [model["hz"][n] for n in ("ulp", "lp", "hp")]
+        self.active_ua = [kit_value(model["active_ua"], kit)[n] for n in ("ulp", "lp", "hp")]
+        self.sleep_ua = [kit_value(model["sleep_ua"], kit)[n] for n in ("ulp", "lp", "hp")]
+
+        tr = model["transition"]
+        lock = tr["dpll_lock_us"] * tr["dpll_locks"]
+        self.switch_us = {(HP, LP): lock + tr["settle_us"]["hp-lp"],
+                          (LP, ULP): lock + tr["settle_us"]["lp-ulp"]}
+
+        self.idle_states = []
+        for name in ("hibernate", "deep_sleep"):
+            state = model[name]
+            if state["min_idle_ms"] is not None:
+                self.idle_states.append((name, state["min_idle_ms"] * 1000.0, kit_value(state["ua"], kit),
+                                         state["entry_us"], state["exit_us"]))
+
+    def run(self, work, end, level, decide):
+        """Replays the work. decide(now_us, busy_us, idle_us) is called at
+        every decision point of the policy and returns the level wanted, or
+        None to keep the current one; it also returns the next decision time."""
+        self.t = 0.0
+        self.level = level
+        self.charge_uc = 0.0
+        self.residency = {}
+        self.transitions = 0
+        self.idle_entries = {}
+        self.busy_us = 0.0
+        self.idle_us = 0.0
+        misses = 0
+        late_max = 0.0
+
+        queue = []
+        pending = list(work)
+        next_decision = 0.0
+
+        while pending or queue or self.t < end:
+            if self.t >= next_decision:
+                want, next_decision = decide(self.t, self.busy_us, self.idle_us)
+                self.busy_us = self.idle_us = 0.0
+                if want is not None:
+                    self.switch(want)
+                continue
+
+            while pending and pending[0][0] <= self.t:
+                release, cycles, deadline = pending.pop(0)
+                queue.append([release, float(cycles), deadline])
+
+            if queue:
+                # The work in progress runs until done or the next decision
+                job = queue[0]
+                done = self.t + job[1] * 1e6 / self.hz[self.level]
+                stop = min(done, next_decision)
+                self.account("run " + LEVEL_NAMES[self.level], stop - self.t, self.active_ua[self.level])
+                self.busy_us += stop - self.t
+                job[1] -= (stop - self.t) * self.hz[self.level] / 1e6
+                self.t = stop
+                if stop >= done:
+                    queue.pop(0)
+                    if job[2] is not None and self.t > job[0] + job[2]:
+                        misses += 1
+                        late_max = max(late_max, self.t - job[0] - job[2])
+                continue
+
+            # Idle until the next release, decision, or the end
+            until = min([next_decision] + [p[0] for p in pending[:1]] + ([end] if end > self.t else []))
+            self.idle(until - self.t)
+
+        return {"charge_uc": self.charge_uc, "time_us": self.t, "misses": misses,
+                "late_max_us": late_max, "transitions": self.transitions,
+                "residency": self.residency, "idle_entries": self.idle_entries}
+
+    def account(self, state, us, ua):
+        self.residency[state] = self.residency.get(state, 0.0) + us
+        self.charge_uc += ua * us / 1e6
+
+    def switch(self, want):
+        """Steps to the wanted level, ULP is entered and left through LP."""
+        while want != self.level:
+            step = self.level + (1 if want > self.level else -1)
+            us = self.switch_us[(max(step, self.level), min(step, self.level))]
+            self.account("switch", us, self.active_ua[min(step, self.level)])
+            self.busy_us += us
+            self.t += us
+            self.level = step
+            self.transitions += 1
+
+    def idle(self, us):
+        """Spends the gap in the deepest idle state it is long enough for. The
+        wake-up from Deep Sleep or hibernate ends after the gap."""
+        for name, min_us, ua, entry_us, exit_us in self.idle_states:
+            if us >= min_us and us > entry_us:
+                self.account(name, entry_us + exit_us, self.active_ua[self.level])
+                self.account(name, us - entry_us, ua)
+                self.idle_entries[name] = self.idle_entries.get(name, 0) + 1
+                self.idle_us += us
+                self.busy_us += exit_us
+                self.t += us + exit_us
+                return
+
+        self.account("sleep " + LEVEL_NAMES[self.level], us, self.sleep_ua[self.level])
+        self.idle_us += us
+        self.t += us
+
+
+def fixed_policy(level):
+    return lambda now, busy, idle: (level, float("inf"))
+
+
+def recorded_policy(modes):
+    modes = list(modes)
+
+    def decide(now, busy, idle):
+        want = None
+        while modes and modes[0][0] <= now:
+            want = modes.pop(0)[1]
+        return want, modes[0][0] if modes else float("inf")
+
+    return decide
+
+
+def governor_policy(lib, name, cfg):
+    gov = Governor()
+    gcfg = GovernorCfg(cfg["up_pct"], cfg["down_pct"], cfg["down_windows"], cfg["min_interval_ms"])
+    policy = ctypes.addressof(ctypes.c_char.in_dll(lib, GOVERNORS[name]))
+    window = cfg["window_ms"] * 1000.0
+    lib.dvfs_governor_init(ctypes.byref(gov), policy, ctypes.byref(gcfg), HP, 0)
+
+    def decide(now, busy, idle):
+        want = None
+        if now > 0:
+            want = lib.dvfs_governor_sample(ctypes.byref(gov), int(busy), int(idle), int(now / 1000.0))
+        return want, now + window
+
+    return decide
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(prog="energy_sim.py", description="Replays a recorded workload "
+                                     "against a power model for every power policy.")
+    parser.add_argument("recording")
+    parser.add_argument("-m", "--model")
+    parser.add_argument("-k", "--kit", choices=["epc2", "epc4"], default="epc2")
+    parser.add_argument("-p", "--policies", default=",".join(POLICIES))
+    parser.add_argument("-d", "--deadline", type=float)
+    parser.add_argument("--csv", action="store_true")
+    parser.add_argument("--strict", action="store_true")
+    args = parser.parse_args(argv[1:])
+
+    model = json.loads(json.dumps(MODEL))
+    if args.model:
+        with open(args.model, "r", encoding="utf-8") as f:
+            merge_model(model, json.load(f))
+
+    if args.recording.endswith(".json"):
+        work, modes, end = read_trace(args.recording, model, args.deadline)
+    else:
+        work, modes, end = read_recording(args.recording, args.deadline)
+
+    policies = args.policies.split(",")
+    for name in policies:
+        if name not in POLICIES:
+            parser.error("unknown policy %s, use %s" % (name, ",".join(POLICIES)))
+
+    sim = Simulator(model, args.kit)
+    results = []
+    with tempfile.TemporaryDirectory() as tmpdir:
+        lib = load_governor(tmpdir) if any(name in GOVERNORS for name in policies) else None
+
+        for name in policies:
+            if name == "recorded":
+                decide = recorded_policy(modes)
+            elif name in GOVERNORS:
+                decide = governor_policy(lib, name, model["governor"])
+            else:
+                decide = fixed_policy(LEVELS[name])
+            results.append((name, sim.run(work, end, HP, decide)))
+
+    print("%d work items, %d cycles, %.1f ms recorded, %s model" %
+          (len(work), sum(c for _, c, _ in work), end / 1000.0, args.kit.upper()))
+
+    states = ["run HP", "run LP", "run ULP", "sleep HP", "sleep LP", "sleep ULP", "switch",
+              "deep_sleep", "hibernate"]
+    if args.csv:
+        print("policy,charge_uah,avg_ua,energy_mj,misses,late_max_ms,transitions,deep_sleeps,hibernates," +
+              ",".join(s.replace(" ", "_").lower() + "_ms" for s in states))
+    else:
+        print("%-13s %10s %8s %9s %6s %8s %6s %5s  %s" % ("policy", "uAh", "avg uA", "mJ", "misses",
+                                                          "late ms", "trans", "DS", "residency"))
+
+    for name, r in results:
+        uah = r["charge_uc"] / 3600.0
+        avg_ua = r["charge_uc"] * 1e6 / r["time_us"] if r["time_us"] else 0.0
+        mj = r["charge_uc"] * model["supply_mv"] / 1e6
+        if args.csv:
+            print("%s,%.3f,%.1f,%.3f,%d,%.3f,%d,%d,%d,%s" % (
+                name, uah, avg_ua, mj, r["misses"], r["late_max_us"] / 1000.0, r["transitions"],
+                r["idle_entries"].get("deep_sleep", 0), r["idle_entries"].get("hibernate", 0),
+                ",".join("%.3f" % (r["residency"].get(s, 0.0) / 1000.0) for s in states)))
+        else:
+            residency = " ".join("%s %.0f%%" % (s, 100.0 * r["residency"][s] / r["time_us"])
+                                 for s in states if r["residency"].get(s) and r["time_us"])
+            print("%-13s %10.3f %8.1f %9.3f %6d %8.2f %6d %5d  %s" % (
+                name, uah, avg_ua, mj, r["misses"], r["late_max_us"] / 1000.0, r["transitions"],
+                r["idle_entries"].get("deep_sleep", 0), residency))
+
+    if args.strict and any(r["misses"] for _, r in results):
+        return 2
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
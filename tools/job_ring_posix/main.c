@@ -0,0 +1,401 @@
+/*******************************************************************************
+ * File Name:   main.c
+ *
+ * Description: This file contains the host stress test of the job ring in
+ *              shared/job_ring.c. A producer and a consumer thread share one
+ *              ring as the CM33 and the CM55 do, with a semaphore for the
+ *              doorbell, and check that every job runs once, in order and
+ *              with its contents intact, also across the wrap of the indices.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "job_ring.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Jobs queued in each round */
+#define HARNESS_JOBS                (200000UL)
+
+/* The sync callbacks yield on every this many calls, to vary the interleaving
+ * of the two threads */
+#define HARNESS_YIELD_EVERY         (7U)
+
+/* The producer ends an incomplete batch on every this many jobs, as the flush
+ * timer does */
+#define HARNESS_FLUSH_EVERY         (13UL)
+
+/* A doorbell that does not come within this time means a job was queued
+ * without one */
+#define HARNESS_DOORBELL_TIMEOUT_S  (2)
+
+/* Status the consumer returns for a job */
+#define HARNESS_STATUS(op)          ((op) ^ 0xA5A5A5A5UL)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* One run of the producer and the consumer */
+typedef struct
+{
+    const char*     name;
+    uint32_t        start;          /* Initial head and tail */
+    uint32_t        batch;          /* Jobs per doorbell */
+} harness_round_t;
+
+/* Consumer state, checked by the handler */
+typedef struct
+{
+    uint32_t        next_op;        /* Operation of the next job to run */
+    uint32_t        next_seq;       /* Sequence number of the next job to run */
+    uint32_t        errors;         /* Jobs that ran out of order or corrupted */
+    uint32_t        drained;        /* Jobs run */
+} harness_consumer_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static const harness_round_t harness_rounds[] =
+{
+    { "batch of 1",             0UL,            1UL },
+    { "batch of 4",             0UL,            4UL },
+    { "index wrap, batch of 4", 0xFFFFFF00UL,   4UL },
+    { "index wrap, batch of 16", 0xFFFFFFF8UL,  JOB_RING_LEN }
+};
+
+static job_ring_t harness_ring;
+static sem_t harness_doorbell;
+static atomic_uint harness_sync_calls;
+static atomic_bool harness_timed_out;
+
+static uint32_t harness_failures = 0UL;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: harness_check
+********************************************************************************
+* Summary:
+*  Records a failed check.
+*
+* Parameters:
+*  ok - result of the check
+*  what - description of the check
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_check(bool ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+
+    if (!ok)
+    {
+        harness_failures++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_sync
+********************************************************************************
+* Summary:
+*  Publish and fetch callback of both sides. Memory is coherent on the host, so
+*  it only yields now and then to let the other thread run at a different point
+*  of the protocol.
+*
+* Parameters:
+*  addr - start of the shared data
+*  size - size of the shared data in bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_sync(volatile void* addr, uint32_t size)
+{
+    (void)addr;
+    (void)size;
+
+    if (0U == (atomic_fetch_add(&harness_sync_calls, 1U) % HARNESS_YIELD_EVERY))
+    {
+        (void)sched_yield();
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_job
+********************************************************************************
+* Summary:
+*  Fills in job number i with a pattern derived from i.
+*
+* Parameters:
+*  job - job to fill in
+*  i - job number
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_job(job_ring_job_t* job, uint32_t i)
+{
+    job->op = i;
+    job->seq = 0UL;
+    job->in = i * 3UL;
+    job->in_len = i ^ 0x5A5AUL;
+    job->out = ~i;
+    job->out_len = i + 7UL;
+    job->status = 0UL;
+    job->reserved = 0UL;
+}
+
+/*******************************************************************************
+* Function Name: harness_handler
+********************************************************************************
+* Summary:
+*  Runs a job. Checks that it is the next one queued and that its contents
+*  arrived intact.
+*
+* Parameters:
+*  job - job to run
+*  arg - consumer state
+*
+* Return:
+*  uint32_t - job status
+*
+*******************************************************************************/
+static uint32_t harness_handler(const job_ring_job_t* job, void* arg)
+{
+    harness_consumer_t* cons = (harness_consumer_t*)arg;
+    job_ring_job_t expected;
+
+    harness_job(&expected, cons->next_op);
+
+    if ((job->op != expected.op) || (job->seq != cons->next_seq) || (job->in != expected.in) ||
+        (job->in_len != expected.in_len) || (job->out != expected.out) ||
+        (job->out_len != expected.out_len) || (0UL != job->status))
+    {
+        if (0UL == cons->errors)
+        {
+            printf("  job %lu: op %lu seq %lu, expected seq %lu\n", (unsigned long)cons->next_op,
+                   (unsigned long)job->op, (unsigned long)job->seq, (unsigned long)cons->next_seq);
+        }
+        cons->errors++;
+    }
+
+    cons->next_op++;
+    cons->next_seq++;
+    cons->drained++;
+
+    return HARNESS_STATUS(job->op);
+}
+
+/*******************************************************************************
+* Function Name: harness_consumer_thread
+********************************************************************************
+* Summary:
+*  Consumer, the CM55 side. Drains the ring on every doorbell until all jobs
+*  of the round have run.
+*
+* Parameters:
+*  arg - consumer state
+*
+* Return:
+*  void* - NULL
+*
+*******************************************************************************/
+static void* harness_consumer_thread(void* arg)
+{
+    harness_consumer_t* state = (harness_consumer_t*)arg;
+    job_ring_consumer_t cons;
+
+    job_ring_consumer_init(&cons, &harness_ring, harness_sync, harness_sync);
+
+    while (state->drained < HARNESS_JOBS)
+    {
+        struct timespec deadline;
+
+        (void)clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += HARNESS_DOORBELL_TIMEOUT_S;
+
+        if ((0 != sem_timedwait(&harness_doorbell, &deadline)) && (ETIMEDOUT == errno))
+        {
+            atomic_store(&harness_timed_out, true);
+            break;
+        }
+
+        (void)job_ring_drain(&cons, harness_handler, state);
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: harness_run
+********************************************************************************
+* Summary:
+*  Runs one round. The main thread is the producer, the CM33 side. It retries
+*  a job on a full ring and rings the doorbell whenever the ring asks for it.
+*
+* Parameters:
+*  round - round to run
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_run(const harness_round_t* round)
+{
+    harness_consumer_t state = { 0UL };
+    job_ring_producer_t prod;
+    pthread_t consumer;
+    uint32_t done_seq = round->start;
+    uint32_t last_seq = round->start;
+    bool done_lost = false;
+    char what[128];
+
+    printf("Round: %s\n", round->name);
+
+    job_ring_init(&harness_ring, harness_sync);
+    harness_ring.head = round->start;
+    harness_ring.tail = round->start;
+    job_ring_producer_init(&prod, &harness_ring, round->batch, harness_sync, harness_sync);
+
+    state.next_seq = round->start;
+    atomic_store(&harness_timed_out, false);
+    (void)sem_init(&harness_doorbell, 0, 0U);
+    (void)pthread_create(&consumer, NULL, harness_consumer_thread, &state);
+
+    for (uint32_t i = 0UL; (i < HARNESS_JOBS) && !atomic_load(&harness_timed_out); )
+    {
+        job_ring_job_t job;
+        job_ring_status_t status;
+
+        harness_job(&job, i);
+        status = job_ring_push(&prod, &job, &last_seq);
+
+        if (JOB_RING_FULL == status)
+        {
+            /* Make sure the consumer knows about the queued jobs */
+            if (job_ring_flush(&prod))
+            {
+                (void)sem_post(&harness_doorbell);
+            }
+            (void)sched_yield();
+            continue;
+        }
+
+        if ((JOB_RING_SIGNAL == status) ||
+            ((0UL == (i % HARNESS_FLUSH_EVERY)) && job_ring_flush(&prod)))
+        {
+            (void)sem_post(&harness_doorbell);
+        }
+        i++;
+
+        /* Once a job is done it stays done, and so do the ones before it */
+        if (job_ring_done(&prod, done_seq))
+        {
+            if (!job_ring_done(&prod, done_seq - 1UL))
+            {
+                done_lost = true;
+            }
+            done_seq++;
+        }
+    }
+
+    if (job_ring_flush(&prod))
+    {
+        (void)sem_post(&harness_doorbell);
+    }
+    (void)pthread_join(consumer, NULL);
+    (void)sem_destroy(&harness_doorbell);
+
+    harness_check(!atomic_load(&harness_timed_out), "every queued job is followed by a doorbell");
+    (void)snprintf(what, sizeof(what), "%lu jobs run", (unsigned long)state.drained);
+    harness_check(HARNESS_JOBS == state.drained, what);
+    harness_check(0UL == state.errors, "jobs run once, in order and intact");
+    harness_check(job_ring_done(&prod, last_seq), "the last job is done");
+    harness_check(!done_lost, "done jobs stay done");
+    harness_check(0UL == job_ring_depth(&prod), "the ring is empty");
+    harness_check(HARNESS_JOBS == prod.pushed, "the producer counted every queued job");
+    harness_check((prod.max_depth <= JOB_RING_LEN) && (harness_ring.max_batch > 0UL),
+                  "the depth and batch statistics are in range");
+    harness_check(HARNESS_STATUS(HARNESS_JOBS - 1UL) ==
+                  harness_ring.slots[last_seq & (JOB_RING_LEN - 1U)].status,
+                  "the consumer wrote the job status");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs all rounds.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int
+*
+*******************************************************************************/
+int main(void)
+{
+    for (uint32_t i = 0UL; i < (sizeof(harness_rounds) / sizeof(harness_rounds[0])); i++)
+    {
+        harness_run(&harness_rounds[i]);
+    }
+
+    printf("%lu failures\n", (unsigned long)harness_failures);
+
+    return (0UL == harness_failures) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+################################################################################
+# \file log_decode.py
+# \version 1.0
+#
+# \brief
+# Decodes the debug UART output of a non-secure image built with
+# LOG_TOKENIZED=1. Tokenized log frames are formatted with the dictionary
+# proj_cm33_ns/log_tokens.def, plain text is passed through, and console
+# response and event frames are printed in hex. Names from fixed tables are
+# sent as indices and looked up in NAMES.
+#
+# Usage: log_decode.py <log_tokens.def> [<capture.bin>]
+#        Reads the standard input when no capture file is given, for example
+#        from a serial port set to raw mode.
+#
+################################################################################
+# \copyright
+# (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import re
+import struct
+import sys
+
+# Must match CONSOLE_* in proj_cm33_ns/console.h
+FRAME_SYNC = 0xA5
+FRAME_HEADER_LEN = 5
+FRAME_TRAILER_LEN = 2
+FRAME_PAYLOAD_MAX = 128
+FRAME_TYPES = {0x01: "response", 0x02: "event", 0x03: "log"}
+FRAME_LOG = 0x03
+
+# Must match power_level_names in proj_cm33_ns/main.c, by dvfs_level_t
+LEVELS = ["Ultra Low Power", "Low Power", "High Performance"]
+# Must match the policy names in proj_cm33_ns/dvfs_governor.c, by dvfs_policy_id_t
+POLICIES = ["ondemand", "conservative", "race-to-idle"]
+# Vote clients by perf_vote_holder_id(), in the registration order of
+# proj_cm33_ns/main.c
+VOTE_HOLDERS = ["none", "governor", "CM55", "console"]
+
+# Name tables of the LOG_TOKEN_NAME() arguments, by token and argument, None
+# for the other arguments
+NAMES = {
+    "PERF_LEVEL": [LEVELS, VOTE_HOLDERS],
+    "GOVERNOR": [POLICIES, None, LEVELS],
+    "DS_WAKE": [LEVELS],
+}
+
+CONVERSION = re.compile(r"%(-?\d*)l*([udxXcs%])")
+ENTRY = re.compile(r"LOG_TOKEN\(\s*(\w+)\s*,\s*\"(\w*)\"\s*,\s*((?:\"(?:[^\"\\]|\\.)*\"\s*)+)\)")
+LITERAL = re.compile(r"\"((?:[^\"\\]|\\.)*)\"")
+ESCAPES = {"r": "\r", "n": "\n", "t": "\t", "\"": "\"", "\\": "\\"}
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT, same as console_crc16()."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def unescape(text):
+    return re.sub(r"\\(.)", lambda m: ESCAPES.get(m.group(1), m.group(1)), text)
+
+
+def read_dictionary(path):
+    """Returns (name, signature, python format) for every token, in ID order."""
+    with open(path, "r", encoding="utf-8") as f:
+        text = re.sub(r"/\*.*?\*/", "", f.read(), flags=re.S)
+
+    tokens = []
+    for name, signature, literals in ENTRY.findall(text):
+        fmt = "".join(unescape(s) for s in LITERAL.findall(literals))
+        conversions = [c for _, c in CONVERSION.findall(fmt) if c != "%"]
+        names = NAMES.get(name, [])
+        # A name sent as its index is a 32-bit integer with a %s conversion
+        expected = "".join("s" if c == "s" and (i >= len(names) or names[i] is None) else "u"
+                           for i, c in enumerate(conversions))
+        if expected != signature:
+            raise ValueError("%s: signature \"%s\" does not match the format, expected \"%s\"" %
+                             (name, signature, expected))
+        fmt = CONVERSION.sub(lambda m: "%" + m.group(1) + ("d" if m.group(2) == "u" else m.group(2)), fmt)
+        tokens.append((name, signature, fmt))
+
+    return tokens
+
+
+def decode_log(tokens, payload):
+    if len(payload) < 2:
+        return "<short log frame>\r\n"
+
+    token_id, = struct.unpack_from("<H", payload, 0)
+    if token_id >= len(tokens):
+        return "<unknown token %d, stale dictionary?>\r\n" % token_id
+
+    name, signature, fmt = tokens[token_id]
+    names = NAMES.get(name, [])
+    args = []
+    pos = 2
+    for i, kind in enumerate(signature):
+        if kind == "s" and pos < len(payload):
+            n = payload[pos]
+            args.append(payload[pos + 1:pos + 1 + n].decode("utf-8", "replace"))
+            pos += 1 + n
+        elif kind == "u" and pos + 4 <= len(payload):
+            value = struct.unpack_from("<I", payload, pos)[0]
+            table = names[i] if i < len(names) else None
+            if table is not None:
+                value = table[value] if value < len(table) else "<unknown %d>" % value
+            args.append(value)
+            pos += 4
+        else:
+            return "<%s: truncated arguments %r>\r\n" % (name, args)
+
+    if token_id == 0 and args[0] != len(tokens):
+        return "<device dictionary has %d tokens, this one %d>\r\n" % (args[0], len(tokens))
+
+    return fmt % tuple(args)
+
+
+def decode(tokens, stream, out):
+    buf = b""
+    log_seq = None
+    # Returns what is available instead of waiting for a full block
+    read = getattr(stream, "read1", stream.read)
+
+    while True:
+        data = read(256)
+        if data:
+            buf += data
+
+        while buf:
+            sync = buf.find(bytes([FRAME_SYNC]))
+            if sync != 0:
+                text = buf if sync < 0 else buf[:sync]
+                out.write(text.decode("utf-8", "replace"))
+                buf = b"" if sync < 0 else buf[sync:]
+                continue
+
+            if len(buf) < FRAME_HEADER_LEN:
+                break
+            ftype, seq, length = buf[1], buf[2], buf[3] | (buf[4] << 8)
+            if ftype not in FRAME_TYPES or length > FRAME_PAYLOAD_MAX:
+                out.write(chr(FRAME_SYNC))
+                buf = buf[1:]
+                continue
+            total = FRAME_HEADER_LEN + length + FRAME_TRAILER_LEN
+            if len(buf) < total:
+                break
+
+            payload = buf[FRAME_HEADER_LEN:FRAME_HEADER_LEN + length]
+            crc, = struct.unpack_from("<H", buf, FRAME_HEADER_LEN + length)
+            if crc != crc16(buf[1:FRAME_HEADER_LEN + length]):
+                # Not a frame after all, or a corrupted one
+                out.write(chr(FRAME_SYNC))
+                buf = buf[1:]
+                continue
+            buf = buf[total:]
+
+            if ftype == FRAME_LOG:
+                if log_seq is not None and seq != (log_seq + 1) & 0xFF:
+                    out.write("<%d log messages dropped>\r\n" % ((seq - log_seq - 1) & 0xFF))
+                log_seq = seq
+                out.write(decode_log(tokens, payload))
+            else:
+                out.write("<%s seq %d: %s>\r\n" % (FRAME_TYPES[ftype], seq, payload.hex(" ")))
+
+        out.flush()
+        if not data:
+            if buf:
+                out.write(buf.decode("utf-8", "replace"))
+            return
+
+
+def main(argv):
+    if len(argv) not in (2, 3):
+        print("Usage: log_decode.py <log_tokens.def> [<capture.bin>]")
+        return 1
+
+    tokens = read_dictionary(argv[1])
+
+    if len(argv) == 3:
+        with open(argv[2], "rb") as stream:
+            decode(tokens, stream, sys.stdout)
+    else:
+        decode(tokens, sys.stdin.buffer, sys.stdout)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * File Name:   FreeRTOSConfig.h
+ *
+ * Description: This file contains the FreeRTOS configuration of the host
+ *              build of the FreeRTOS port harness, for the POSIX port.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+void harness_assert_failed(const char* file, int line);
+
+#define configUSE_PREEMPTION                    (1)
+#define configUSE_IDLE_HOOK                     (0)
+#define configUSE_TICK_HOOK                     (0)
+#define configTICK_RATE_HZ                      (100)
+#define configMAX_PRIORITIES                    (5)
+#define configMINIMAL_STACK_SIZE                (4096)
+#define configMAX_TASK_NAME_LEN                 (16)
+#define configUSE_16_BIT_TICKS                  (0)
+#define configUSE_MUTEXES                       (1)
+#define configUSE_RECURSIVE_MUTEXES             (1)
+#define configUSE_TIMERS                        (0)
+#define configSUPPORT_DYNAMIC_ALLOCATION        (1)
+#define configSUPPORT_STATIC_ALLOCATION         (0)
+#define configCHECK_FOR_STACK_OVERFLOW          (0)
+#define configUSE_MALLOC_FAILED_HOOK            (0)
+
+/* eTaskConfirmSleepModeStatus and vTaskStepTick are only built for tickless
+ * idle. The idle task does not sleep on the host, the harness calls the hook
+ * itself, like the idle task does on the device. */
+#define configUSE_TICKLESS_IDLE                 (2)
+#define portSUPPRESS_TICKS_AND_SLEEP(idle)      do { } while (0)
+
+#define INCLUDE_vTaskDelay                      (1)
+#define INCLUDE_vTaskSuspend                    (1)
+#define INCLUDE_xTaskGetSchedulerState          (1)
+#define INCLUDE_xSemaphoreGetMutexHolder        (1)
+
+#define configASSERT(x)                         do { if (!(x)) { harness_assert_failed(__FILE__, __LINE__); } } while (0)
+
+#endif /* FREERTOS_CONFIG_H */
+
+/* [] END OF FILE */
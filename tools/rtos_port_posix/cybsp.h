@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * File Name:   cybsp.h
+ *
+ * Description: This file replaces the board support header for the host build
+ *              of the FreeRTOS port harness. The SysTick and SCB registers
+ *              used by rtos_port.c are plain variables the harness inspects.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _HARNESS_CYBSP_H_
+#define _HARNESS_CYBSP_H_
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define SysTick                     (&harness_systick)
+#define SCB                         (&harness_scb)
+
+#define SysTick_CTRL_ENABLE_Msk     (1UL)
+#define SCB_ICSR_PENDSTSET_Msk      (1UL << 26U)
+
+/* The tick is a signal of the POSIX port, it is not masked. With the
+ * scheduler suspended it only pends ticks. */
+#define __disable_irq()             do { } while (0)
+#define __enable_irq()              do { } while (0)
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+typedef struct
+{
+    volatile uint32_t   CTRL;
+    volatile uint32_t   LOAD;
+    volatile uint32_t   VAL;
+} harness_systick_t;
+
+typedef struct
+{
+    volatile uint32_t   ICSR;
+} harness_scb_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern harness_systick_t harness_systick;
+extern harness_scb_t harness_scb;
+extern uint32_t SystemCoreClock;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+/* Not provided by the POSIX port, the harness tasks never run in a signal
+ * handler */
+long xPortIsInsideInterrupt(void);
+
+#endif /* _HARNESS_CYBSP_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,563 @@
+/*******************************************************************************
+ * File Name:   main.c
+ *
+ * Description: This file contains the host harness of the FreeRTOS port layer
+ *              in proj_cm33_ns/COMPONENT_FREERTOS. It runs rtos_port.c on the
+ *              FreeRTOS POSIX port with a simulated SysTick and LPTimer and
+ *              checks the recursive USER SRF lock, the tick bookkeeping of
+ *              rtos_port_suppress_ticks_and_sleep(), and that the hook keeps
+ *              out of Deep Sleep while a task owns the lock.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cybsp.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "user_srf.h"
+#include "event_sched_port.h"
+#include "rtos_port.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define HARNESS_CORE_HZ             (50000000UL)
+#define HARNESS_TICK_COUNTS         (HARNESS_CORE_HZ / configTICK_RATE_HZ)
+
+/* Tick counter counts already elapsed in the tick the sleep starts in */
+#define HARNESS_ELAPSED             (100000UL)
+
+/* Ticks the idle task expects to stay idle for */
+#define HARNESS_EXPECTED_IDLE       (10UL)
+
+/* LPTimer ticks slept before an interrupt other than the match wakes up the
+ * CPU. 1000 ticks are 1525878 counts, 3 whole ticks with the elapsed counts. */
+#define HARNESS_EARLY_WAKE          (1000UL)
+#define HARNESS_EARLY_TICKS         (3UL)
+
+/* LPTimer ticks the wake-up is late by, past the expected idle time */
+#define HARNESS_LATE_WAKE           (400UL)
+
+#define HARNESS_LOCK_DELAY          (5U)
+#define HARNESS_RETRIES             (100U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+harness_systick_t harness_systick;
+harness_scb_t harness_scb;
+uint32_t SystemCoreClock = HARNESS_CORE_HZ;
+
+/* USER SRF lock hooks, as in user_srf/user_srf.c */
+static const cy_stc_user_srf_lock_t* harness_srf_lock = NULL;
+
+/* Simulated LPTimer */
+static uint32_t harness_lptimer_now = 0UL;
+static uint32_t harness_lptimer_match = 0UL;
+static uint32_t harness_lptimer_armed = 0UL;
+static uint32_t harness_lptimer_wake = 0UL;     /* Early wake-up, 0 to wake at the match */
+static uint32_t harness_lptimer_late = 0UL;     /* Late wake-up past the match */
+
+/* Deep Sleep holds of the LPTimer port, now and while the CPU idled */
+static uint32_t harness_ds_holds = 0UL;
+static uint32_t harness_idle_ds_holds = 0UL;
+
+/* Recursive lock test */
+static volatile uint32_t harness_lock_depth = 0UL;
+static volatile uint32_t harness_lock_owner_releases = 0UL;
+static volatile uint32_t harness_lock_taken_after = 0UL;
+static volatile bool harness_lock_done = false;
+
+static uint32_t harness_failures = 0UL;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: harness_check
+********************************************************************************
+* Summary:
+*  Records a failed check.
+*
+* Parameters:
+*  ok - result of the check
+*  what - description of the check
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_check(bool ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+
+    if (!ok)
+    {
+        harness_failures++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_assert_failed
+********************************************************************************
+* Summary:
+*  configASSERT() handler, stops the harness.
+*
+* Parameters:
+*  file - source file of the assertion
+*  line - source line of the assertion
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void harness_assert_failed(const char* file, int line)
+{
+    printf("FAIL: configASSERT at %s:%d\n", file, line);
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: xPortIsInsideInterrupt
+********************************************************************************
+* Summary:
+*  The harness tasks never run in the tick signal handler.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  long - pdFALSE
+*
+*******************************************************************************/
+long xPortIsInsideInterrupt(void)
+{
+    return pdFALSE;
+}
+
+/*******************************************************************************
+* Function Name: cy_user_srf_set_lock
+********************************************************************************
+* Summary:
+*  Installs the USER SRF lock hooks.
+*
+* Parameters:
+*  lock - lock hooks, NULL to remove them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cy_user_srf_set_lock(const cy_stc_user_srf_lock_t* lock)
+{
+    harness_srf_lock = lock;
+}
+
+/*******************************************************************************
+* Function Name: cy_user_srf_lock
+********************************************************************************
+* Summary:
+*  Takes the USER SRF lock, if one is installed.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cy_user_srf_lock(void)
+{
+    if ((NULL != harness_srf_lock) && (NULL != harness_srf_lock->acquire))
+    {
+        harness_srf_lock->acquire();
+    }
+}
+
+/*******************************************************************************
+* Function Name: cy_user_srf_unlock
+********************************************************************************
+* Summary:
+*  Gives back the USER SRF lock, if one is installed.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cy_user_srf_unlock(void)
+{
+    if ((NULL != harness_srf_lock) && (NULL != harness_srf_lock->release))
+    {
+        harness_srf_lock->release();
+    }
+}
+
+/* Simulated LPTimer port, it only advances while the CPU idles */
+static uint32_t harness_lptimer_now_get(void)
+{
+    return harness_lptimer_now;
+}
+
+static bool harness_lptimer_set_wakeup(uint32_t tick)
+{
+    harness_lptimer_match = tick;
+    harness_lptimer_armed++;
+
+    return true;
+}
+
+static void harness_lptimer_idle(uint32_t ticks)
+{
+    (void)ticks;
+
+    harness_idle_ds_holds = harness_ds_holds;
+
+    if (0UL != harness_lptimer_wake)
+    {
+        harness_lptimer_now += harness_lptimer_wake;
+    }
+    else
+    {
+        harness_lptimer_now = harness_lptimer_match + harness_lptimer_late;
+    }
+}
+
+static uint32_t harness_lptimer_lock(void)
+{
+    return 0UL;
+}
+
+static void harness_lptimer_unlock(uint32_t state)
+{
+    (void)state;
+}
+
+const event_sched_port_t event_sched_lptimer_port =
+{
+    .now = harness_lptimer_now_get,
+    .set_wakeup = harness_lptimer_set_wakeup,
+    .idle = harness_lptimer_idle,
+    .lock = harness_lptimer_lock,
+    .unlock = harness_lptimer_unlock
+};
+
+void event_sched_port_init(void)
+{
+}
+
+void event_sched_port_hold_ds(bool hold)
+{
+    if (hold)
+    {
+        harness_ds_holds++;
+    }
+    else
+    {
+        harness_ds_holds--;
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_lock_owner_task
+********************************************************************************
+* Summary:
+*  Takes the USER SRF lock twice, as a request nested in a power mode
+*  transition does, and gives it back once per take with delays in between.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_lock_owner_task(void* arg)
+{
+    (void)arg;
+
+    cy_user_srf_lock();
+    harness_lock_depth++;
+    cy_user_srf_lock();
+    harness_lock_depth++;
+
+    vTaskDelay(HARNESS_LOCK_DELAY);
+
+    harness_lock_depth--;
+    harness_lock_owner_releases++;
+    cy_user_srf_unlock();
+
+    vTaskDelay(HARNESS_LOCK_DELAY);
+
+    harness_lock_depth--;
+    harness_lock_owner_releases++;
+    cy_user_srf_unlock();
+
+    vTaskDelete(NULL);
+}
+
+/*******************************************************************************
+* Function Name: harness_lock_waiter_task
+********************************************************************************
+* Summary:
+*  Takes the USER SRF lock while the owner task holds it, and records how
+*  many times the owner had given it back when it got it.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_lock_waiter_task(void* arg)
+{
+    (void)arg;
+
+    vTaskDelay(1U);
+
+    cy_user_srf_lock();
+    harness_lock_taken_after = harness_lock_owner_releases;
+    harness_check(0UL == harness_lock_depth, "lock not shared with the owner");
+    cy_user_srf_unlock();
+
+    harness_lock_done = true;
+    vTaskDelete(NULL);
+}
+
+/*******************************************************************************
+* Function Name: harness_sleep
+********************************************************************************
+* Summary:
+*  Calls the tickless idle hook with the scheduler suspended, as the idle task
+*  does, from the given SysTick state. A sleep aborted by a tick of the POSIX
+*  port that came in meanwhile is retried after the tick.
+*
+* Parameters:
+*  pend_tick - SysTick interrupt pending at entry
+*  ticks - returns the ticks the tick count was stepped by
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_sleep(bool pend_tick, TickType_t* ticks)
+{
+    TickType_t before;
+
+    for (uint32_t retry = 0UL; retry < HARNESS_RETRIES; retry++)
+    {
+        /* Starts right after a tick, far from the next one */
+        vTaskDelay(1U);
+        vTaskSuspendAll();
+
+        harness_systick.CTRL = SysTick_CTRL_ENABLE_Msk;
+        harness_systick.LOAD = HARNESS_TICK_COUNTS - 1UL;
+        harness_systick.VAL = harness_systick.LOAD - HARNESS_ELAPSED;
+        harness_scb.ICSR = pend_tick ? SCB_ICSR_PENDSTSET_Msk : 0UL;
+        harness_lptimer_armed = 0UL;
+
+        before = xTaskGetTickCount();
+        rtos_port_suppress_ticks_and_sleep(HARNESS_EXPECTED_IDLE);
+        *ticks = xTaskGetTickCount() - before;
+
+        if (eAbortSleep != eTaskConfirmSleepModeStatus())
+        {
+            (void)xTaskResumeAll();
+            return;
+        }
+
+        (void)xTaskResumeAll();
+    }
+
+    harness_check(false, "sleep aborted by a tick on every try");
+}
+
+/*******************************************************************************
+* Function Name: harness_tickless_test
+********************************************************************************
+* Summary:
+*  Checks the tick count step and the SysTick restart of the tickless idle
+*  hook for a sleep to the match, an early and a late wake-up and a tick
+*  pending at entry.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_tickless_test(void)
+{
+    TickType_t ticks;
+
+    /* The match is set the wake-up lead before the expected tick, the last
+     * tick is left to SysTick */
+    harness_lptimer_wake = 0UL;
+    harness_lptimer_late = 0UL;
+    harness_sleep(false, &ticks);
+    harness_check(1UL == harness_lptimer_armed, "full sleep arms the LPTimer");
+    harness_check((HARNESS_EXPECTED_IDLE - 1UL) == ticks, "full sleep steps the expected idle less one tick");
+    harness_check(0UL == (harness_scb.ICSR & SCB_ICSR_PENDSTSET_Msk), "full sleep leaves the tick to SysTick");
+    harness_check((HARNESS_TICK_COUNTS - 1UL) == harness_systick.LOAD, "full sleep restores the reload");
+    harness_check(0UL != (harness_systick.CTRL & SysTick_CTRL_ENABLE_Msk), "full sleep restarts SysTick");
+
+    /* Only the whole ticks slept are stepped */
+    harness_lptimer_wake = HARNESS_EARLY_WAKE;
+    harness_sleep(false, &ticks);
+    harness_check(HARNESS_EARLY_TICKS == ticks, "early wake-up steps the whole ticks slept");
+    harness_check((HARNESS_TICK_COUNTS - 1UL) == harness_systick.LOAD, "early wake-up restores the reload");
+
+    /* Never past the expected idle time, the tick due is pended at once */
+    harness_lptimer_wake = 0UL;
+    harness_lptimer_late = HARNESS_LATE_WAKE;
+    harness_sleep(false, &ticks);
+    harness_check((HARNESS_EXPECTED_IDLE - 1UL) == ticks, "late wake-up steps the expected idle less one tick");
+    harness_check(0UL != (harness_scb.ICSR & SCB_ICSR_PENDSTSET_Msk), "late wake-up pends the tick");
+    harness_check((HARNESS_TICK_COUNTS - 1UL) == harness_systick.LOAD, "late wake-up restores the reload");
+    harness_lptimer_late = 0UL;
+
+    /* A tick that expired before SysTick was stopped is not lost */
+    harness_sleep(true, &ticks);
+    harness_check(0UL == harness_lptimer_armed, "pending tick does not sleep");
+    harness_check(0U == ticks, "pending tick does not step the tick count");
+    harness_check(0UL != (harness_systick.CTRL & SysTick_CTRL_ENABLE_Msk), "pending tick keeps SysTick running");
+}
+
+/*******************************************************************************
+* Function Name: harness_srf_owned_test
+********************************************************************************
+* Summary:
+*  Checks that the tickless idle hook holds Deep Sleep off while a task owns
+*  the USER SRF lock, and only then.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_srf_owned_test(void)
+{
+    TickType_t ticks;
+
+    harness_lptimer_wake = 0UL;
+    harness_lptimer_late = 0UL;
+
+    cy_user_srf_lock();
+    harness_idle_ds_holds = 0UL;
+    harness_sleep(false, &ticks);
+    harness_check(1UL == harness_idle_ds_holds, "owned SRF lock holds Deep Sleep off");
+    harness_check(0UL == harness_ds_holds, "owned SRF lock hold is released after the sleep");
+    cy_user_srf_unlock();
+
+    harness_idle_ds_holds = 1UL;
+    harness_sleep(false, &ticks);
+    harness_check(0UL == harness_idle_ds_holds, "free SRF lock allows Deep Sleep");
+}
+
+/*******************************************************************************
+* Function Name: harness_task
+********************************************************************************
+* Summary:
+*  Runs the tests and exits with the result.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_task(void* arg)
+{
+    (void)arg;
+
+    while (!harness_lock_done)
+    {
+        vTaskDelay(1U);
+    }
+    harness_check(2UL == harness_lock_taken_after, "recursive lock held until the last release");
+
+    harness_tickless_test();
+    harness_srf_owned_test();
+
+    printf("%lu failures\n", (unsigned long)harness_failures);
+    exit((0UL == harness_failures) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Installs the port layer and starts the scheduler with the test tasks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int
+*
+*******************************************************************************/
+int main(void)
+{
+    rtos_port_init();
+
+    /* Before the scheduler starts the lock is not taken */
+    cy_user_srf_lock();
+    cy_user_srf_lock();
+    cy_user_srf_unlock();
+    cy_user_srf_unlock();
+
+    (void)xTaskCreate(harness_lock_owner_task, "owner", configMINIMAL_STACK_SIZE, NULL, 2U, NULL);
+    (void)xTaskCreate(harness_lock_waiter_task, "waiter", configMINIMAL_STACK_SIZE, NULL, 2U, NULL);
+    (void)xTaskCreate(harness_task, "harness", configMINIMAL_STACK_SIZE, NULL, 1U, NULL);
+
+    vTaskStartScheduler();
+
+    return EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
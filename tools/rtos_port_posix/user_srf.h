@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * File Name:   user_srf.h
+ *
+ * Description: This file replaces the USER SRF interface for the host build
+ *              of the FreeRTOS port harness. Only the lock hooks are kept,
+ *              with the same behaviour as user_srf/user_srf.c.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+#ifndef _HARNESS_USER_SRF_H_
+#define _HARNESS_USER_SRF_H_
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Same as in user_srf/user_srf.h */
+typedef struct
+{
+    void (*acquire)(void);      /* Takes the lock, blocking */
+    void (*release)(void);      /* Gives the lock back */
+} cy_stc_user_srf_lock_t;
+
+/*******************************************************************************
+* Function prototypes
+*******************************************************************************/
+void cy_user_srf_set_lock(const cy_stc_user_srf_lock_t* lock);
+void cy_user_srf_lock(void);
+void cy_user_srf_unlock(void);
+
+#endif /* _HARNESS_USER_SRF_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,739 @@
+/*******************************************************************************
+ * File Name:   main.c
+ *
+ * Description: This file contains the host test of the scenario engine in
+ *              proj_cm33_ns/scenario.c. It checks that malformed scenario
+ *              text is rejected at the right position, and runs scenarios on
+ *              the event scheduler with a simulated port and clock to check
+ *              the step order, the results and the end of the scenario.
+ *
+ * Related Document: See README.md
+ *
+ *******************************************************************************
+ * (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+ * Technologies AG. All rights reserved.
+ * This software, associated documentation and materials ("Software") is
+ * owned by Infineon Technologies AG or one of its affiliates ("Infineon")
+ * and is protected by and subject to worldwide patent protection, worldwide
+ * copyright laws, and international treaty provisions. Therefore, you may use
+ * this Software only as provided in the license agreement accompanying the
+ * software package from which you obtained this Software. If no license
+ * agreement applies, then any use, reproduction, modification, translation, or
+ * compilation of this Software is prohibited without the express written
+ * permission of Infineon.
+ *
+ * Disclaimer: UNLESS OTHERWISE EXPRESSLY AGREED WITH INFINEON, THIS SOFTWARE
+ * IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING, BUT NOT LIMITED TO, ALL WARRANTIES OF NON-INFRINGEMENT OF
+ * THIRD-PARTY RIGHTS AND IMPLIED WARRANTIES SUCH AS WARRANTIES OF FITNESS FOR A
+ * SPECIFIC USE/PURPOSE OR MERCHANTABILITY.
+ * Infineon reserves the right to make changes to the Software without notice.
+ * You are responsible for properly designing, programming, and testing the
+ * functionality and safety of your intended application of the Software, as
+ * well as complying with any legal requirements related to its use. Infineon
+ * does not guarantee that the Software will be free from intrusion, data theft
+ * or loss, or other breaches ("Security Breaches"), and Infineon shall have
+ * no liability arising out of any Security Breaches. Unless otherwise
+ * explicitly approved by Infineon, the Software may not be used in any
+ * application where a failure of the Product or any consequences of the use
+ * thereof can reasonably be expected to result in personal injury.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "scenario.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* The simulated scheduler ticks once per millisecond */
+#define HARNESS_TICK_HZ             (1000UL)
+#define HARNESS_US_PER_TICK         (1000000UL / HARNESS_TICK_HZ)
+
+/* Time the simulated steps take beyond their nominal duration */
+#define HARNESS_MODE_US             (50UL)
+#define HARNESS_WORK_US             (7UL)
+#define HARNESS_DS_US               (120UL)
+
+#define HARNESS_ITERATIONS          (3UL)
+#define HARNESS_MAX_CALLS           (64U)
+
+/* Scheduler loop passes after which a scenario counts as stuck */
+#define HARNESS_MAX_PASSES          (1000U)
+
+#define HARNESS_COUNT(a)            ((uint32_t)(sizeof(a) / sizeof((a)[0])))
+
+/*******************************************************************************
+* Data Structures
+*******************************************************************************/
+
+/* Hook calls recorded by the simulation */
+typedef enum
+{
+    HARNESS_CALL_MODE,
+    HARNESS_CALL_WORK,
+    HARNESS_CALL_DS,
+    HARNESS_CALL_ITERATION,
+    HARNESS_CALL_DONE
+} harness_call_kind_t;
+
+typedef struct
+{
+    harness_call_kind_t kind;
+    uint32_t            arg;
+    uint32_t            start_us;   /* Simulated time the call was made at */
+    uint32_t            end_us;     /* Simulated time the call returned at */
+} harness_call_t;
+
+/* Malformed scenario text and the offset it must be rejected at */
+typedef struct
+{
+    const char*     what;
+    const char*     text;
+    uint32_t        error_pos;
+} harness_bad_text_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+static const harness_bad_text_t harness_bad_texts[] =
+{
+    { "empty text",                 "",                     0UL },
+    { "comment only",               "  # comment only\n",   17UL },
+    { "unknown keyword",            "hp fast",              3UL },
+    { "keyword in upper case",      "HP",                   0UL },
+    { "keyword with a suffix",      "hpx lp",               0UL },
+    { "keyword prefix",             "wor 5",                0UL },
+    { "missing duration",           "work",                 4UL },
+    { "duration commented out",     "work # 5\n",           9UL },
+    { "zero duration",              "work 0",               5UL },
+    { "trailing garbage",           "work 12a",             5UL },
+    { "negative duration",          "work -5",              5UL },
+    { "duration past the maximum",  "lp; dwell 3600001",    10UL },
+    { "overflowing duration",       "ds 99999999999",       3UL },
+    { "missing last duration",      "hp work 5 lp ds",      15UL }
+};
+
+/* Simulated clock and LPTimer */
+static uint32_t harness_now_us = 0UL;
+static uint32_t harness_wakeup = 0UL;
+static bool harness_wakeup_armed = false;
+static bool harness_stalled = false;
+
+/* Hook calls in order */
+static harness_call_t harness_calls[HARNESS_MAX_CALLS];
+static uint32_t harness_num_calls = 0UL;
+static uint32_t harness_lost_calls = 0UL;
+
+/* Power mode the set_mode hook fails for, DVFS_LEVEL_MAX for none */
+static dvfs_level_t harness_fail_level = DVFS_LEVEL_MAX;
+
+static uint32_t harness_failures = 0UL;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Name: harness_check
+********************************************************************************
+* Summary:
+*  Records a failed check.
+*
+* Parameters:
+*  ok - result of the check
+*  what - description of the check
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_check(bool ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+
+    if (!ok)
+    {
+        harness_failures++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_port_now
+********************************************************************************
+* Summary:
+*  Scheduler tick counter of the simulated port.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - current tick
+*
+*******************************************************************************/
+static uint32_t harness_port_now(void)
+{
+    return harness_now_us / HARNESS_US_PER_TICK;
+}
+
+/*******************************************************************************
+* Function Name: harness_port_set_wakeup
+********************************************************************************
+* Summary:
+*  Arms the simulated LPTimer match.
+*
+* Parameters:
+*  tick - tick to wake up at
+*
+* Return:
+*  bool - true
+*
+*******************************************************************************/
+static bool harness_port_set_wakeup(uint32_t tick)
+{
+    harness_wakeup = tick;
+    harness_wakeup_armed = true;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: harness_port_idle
+********************************************************************************
+* Summary:
+*  Idles by advancing the simulated clock to the armed match. Without a match
+*  nothing would wake the CPU, which is recorded as a stall.
+*
+* Parameters:
+*  ticks - ticks to the next timer expiry
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_port_idle(uint32_t ticks)
+{
+    (void)ticks;
+
+    if (harness_wakeup_armed)
+    {
+        harness_now_us = harness_wakeup * HARNESS_US_PER_TICK;
+        harness_wakeup_armed = false;
+    }
+    else
+    {
+        harness_stalled = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_port_lock
+********************************************************************************
+* Summary:
+*  Interrupts are not simulated, nothing to lock.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - 0
+*
+*******************************************************************************/
+static uint32_t harness_port_lock(void)
+{
+    return 0UL;
+}
+
+/*******************************************************************************
+* Function Name: harness_port_unlock
+********************************************************************************
+* Summary:
+*  Counterpart of harness_port_lock().
+*
+* Parameters:
+*  state - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_port_unlock(uint32_t state)
+{
+    (void)state;
+}
+
+static const event_sched_port_t harness_port =
+{
+    .now = harness_port_now,
+    .set_wakeup = harness_port_set_wakeup,
+    .idle = harness_port_idle,
+    .lock = harness_port_lock,
+    .unlock = harness_port_unlock
+};
+
+/*******************************************************************************
+* Function Name: harness_record
+********************************************************************************
+* Summary:
+*  Records a hook call and advances the simulated clock by its duration.
+*
+* Parameters:
+*  kind - hook
+*  arg - hook argument
+*  duration_us - simulated duration of the call
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_record(harness_call_kind_t kind, uint32_t arg, uint32_t duration_us)
+{
+    uint32_t start = harness_now_us;
+
+    harness_now_us += duration_us;
+
+    if (harness_num_calls < HARNESS_MAX_CALLS)
+    {
+        harness_calls[harness_num_calls++] = (harness_call_t){ kind, arg, start, harness_now_us };
+    }
+    else
+    {
+        harness_lost_calls++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: harness_set_mode
+********************************************************************************
+* Summary:
+*  set_mode hook, fails for harness_fail_level.
+*
+* Parameters:
+*  level - power mode
+*  arg - unused
+*
+* Return:
+*  bool - false for harness_fail_level
+*
+*******************************************************************************/
+static bool harness_set_mode(dvfs_level_t level, void* arg)
+{
+    (void)arg;
+    harness_record(HARNESS_CALL_MODE, (uint32_t)level, HARNESS_MODE_US);
+
+    return (level != harness_fail_level);
+}
+
+/*******************************************************************************
+* Function Name: harness_work
+********************************************************************************
+* Summary:
+*  work hook.
+*
+* Parameters:
+*  ms - duration
+*  arg - unused
+*
+* Return:
+*  bool - true
+*
+*******************************************************************************/
+static bool harness_work(uint32_t ms, void* arg)
+{
+    (void)arg;
+    harness_record(HARNESS_CALL_WORK, ms, (ms * 1000UL) + HARNESS_WORK_US);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: harness_deep_sleep
+********************************************************************************
+* Summary:
+*  deep_sleep hook.
+*
+* Parameters:
+*  ms - duration
+*  arg - unused
+*
+* Return:
+*  bool - true
+*
+*******************************************************************************/
+static bool harness_deep_sleep(uint32_t ms, void* arg)
+{
+    (void)arg;
+    harness_record(HARNESS_CALL_DS, ms, (ms * 1000UL) + HARNESS_DS_US);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: harness_now_us_get
+********************************************************************************
+* Summary:
+*  now_us hook.
+*
+* Parameters:
+*  arg - unused
+*
+* Return:
+*  uint32_t - simulated time in microseconds
+*
+*******************************************************************************/
+static uint32_t harness_now_us_get(void* arg)
+{
+    (void)arg;
+
+    return harness_now_us;
+}
+
+/*******************************************************************************
+* Function Name: harness_iteration_done
+********************************************************************************
+* Summary:
+*  iteration_done hook.
+*
+* Parameters:
+*  iteration - iterations completed
+*  arg - unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_iteration_done(uint32_t iteration, void* arg)
+{
+    (void)arg;
+    harness_record(HARNESS_CALL_ITERATION, iteration, 0UL);
+}
+
+/*******************************************************************************
+* Function Name: harness_done
+********************************************************************************
+* Summary:
+*  done hook, the end-of-scenario event.
+*
+* Parameters:
+*  arg - engine state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_done(void* arg)
+{
+    harness_record(HARNESS_CALL_DONE, scenario_running((const scenario_t*)arg) ? 1UL : 0UL, 0UL);
+}
+
+/*******************************************************************************
+* Function Name: harness_reset
+********************************************************************************
+* Summary:
+*  Clears the simulation and the recorded calls.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_reset(void)
+{
+    harness_now_us = 0UL;
+    harness_wakeup_armed = false;
+    harness_stalled = false;
+    harness_num_calls = 0UL;
+    harness_lost_calls = 0UL;
+    harness_fail_level = DVFS_LEVEL_MAX;
+}
+
+/*******************************************************************************
+* Function Name: harness_run
+********************************************************************************
+* Summary:
+*  Runs the scheduler until the scheduler has nothing left to do, or for the
+*  given number of passes.
+*
+* Parameters:
+*  sched - scheduler
+*  passes - most passes to run
+*
+* Return:
+*  uint32_t - passes run
+*
+*******************************************************************************/
+static uint32_t harness_run(event_sched_t* sched, uint32_t passes)
+{
+    uint32_t i;
+
+    for (i = 0UL; (i < passes) && !harness_stalled; i++)
+    {
+        event_sched_run_once(sched);
+    }
+
+    return i;
+}
+
+/*******************************************************************************
+* Function Name: harness_parse_test
+********************************************************************************
+* Summary:
+*  Checks the parser on valid and malformed scenario text.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_parse_test(void)
+{
+    static const scenario_step_t expected[] =
+    {
+        { SCENARIO_OP_MODE, DVFS_LEVEL_HP },
+        { SCENARIO_OP_WORK, 5UL },
+        { SCENARIO_OP_DWELL, 10UL },
+        { SCENARIO_OP_DEEPSLEEP, 3600000UL },
+        { SCENARIO_OP_MODE, DVFS_LEVEL_ULP },
+        { SCENARIO_OP_MODE, DVFS_LEVEL_LP }
+    };
+    scenario_step_t steps[SCENARIO_MAX_STEPS];
+    char text[(SCENARIO_MAX_STEPS + 1U) * 3U + 1U];
+    uint32_t num_steps = 0UL;
+    uint32_t error_pos = UINT32_MAX;
+    bool ok;
+    char what[96];
+
+    ok = scenario_parse(" hp, work 5;dwell\t10 # dwell 99\r\n\n  ds 3600000\nulp,,lp;", steps,
+                        SCENARIO_MAX_STEPS, &num_steps, &error_pos);
+    harness_check(ok && (HARNESS_COUNT(expected) == num_steps) && (UINT32_MAX == error_pos) &&
+                  (0 == memcmp(steps, expected, sizeof(expected))),
+                  "steps, separators and comments are parsed in order");
+
+    for (uint32_t i = 0UL; i < HARNESS_COUNT(harness_bad_texts); i++)
+    {
+        const harness_bad_text_t* bad = &harness_bad_texts[i];
+
+        error_pos = UINT32_MAX;
+        ok = scenario_parse(bad->text, steps, SCENARIO_MAX_STEPS, &num_steps, &error_pos);
+        (void)snprintf(what, sizeof(what), "%s is rejected at offset %lu", bad->what,
+                       (unsigned long)bad->error_pos);
+        harness_check(!ok && (bad->error_pos == error_pos), what);
+        if (bad->error_pos != error_pos)
+        {
+            printf("  rejected at %lu\n", (unsigned long)error_pos);
+        }
+    }
+
+    /* One step more than the table holds */
+    text[0] = '\0';
+    for (uint32_t i = 0UL; i <= SCENARIO_MAX_STEPS; i++)
+    {
+        (void)strcat(text, "hp ");
+    }
+    ok = scenario_parse(text, steps, SCENARIO_MAX_STEPS, &num_steps, &error_pos);
+    harness_check(!ok && ((SCENARIO_MAX_STEPS * 3UL) == error_pos), "a step past the table size is rejected");
+
+    harness_check(scenario_parse("work 1", steps, 1UL, &num_steps, NULL) && (1UL == num_steps),
+                  "the error position is optional");
+}
+
+/*******************************************************************************
+* Function Name: harness_order_test
+********************************************************************************
+* Summary:
+*  Runs a scenario and checks that its steps run in order in every iteration,
+*  that a dwell idles for its duration between its neighbours, and that the
+*  end of the scenario is reported once, after the last step.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_order_test(void)
+{
+    static const scenario_hooks_t hooks_template =
+    {
+        .set_mode = harness_set_mode,
+        .work = harness_work,
+        .deep_sleep = harness_deep_sleep,
+        .now_us = harness_now_us_get,
+        .iteration_done = harness_iteration_done,
+        .done = harness_done,
+        .arg = NULL,
+        .tick_hz = HARNESS_TICK_HZ
+    };
+    /* Calls expected in each iteration, the dwell of 3 ms has no hook */
+    static const harness_call_t expected[] =
+    {
+        { HARNESS_CALL_MODE, DVFS_LEVEL_HP, 0UL, 0UL },
+        { HARNESS_CALL_WORK, 2UL, 0UL, 0UL },
+        { HARNESS_CALL_DS, 4UL, 0UL, 0UL },
+        { HARNESS_CALL_MODE, DVFS_LEVEL_LP, 0UL, 0UL }
+    };
+    static scenario_t sc;
+    scenario_step_t steps[SCENARIO_MAX_STEPS];
+    scenario_hooks_t hooks = hooks_template;
+    event_sched_t sched;
+    uint32_t num_steps;
+    uint32_t call = 0UL;
+    bool order_ok = true;
+    bool dwell_ok = true;
+    uint32_t passes;
+    char line[96];
+
+    harness_reset();
+    hooks.arg = &sc;
+    harness_fail_level = DVFS_LEVEL_LP;
+
+    event_sched_init(&sched, &harness_port);
+    scenario_init(&sc, &sched, &hooks);
+    (void)scenario_parse("hp work 2 dwell 3 ds 4 lp", steps, SCENARIO_MAX_STEPS, &num_steps, NULL);
+
+    harness_check(!scenario_load(&sc, steps, 0UL, HARNESS_ITERATIONS), "an empty table is not loaded");
+    harness_check(!scenario_load(&sc, steps, SCENARIO_MAX_STEPS + 1UL, HARNESS_ITERATIONS),
+                  "a table past the size is not loaded");
+    harness_check(!scenario_load(&sc, steps, num_steps, 0UL), "zero iterations are not loaded");
+    harness_check(scenario_load(&sc, steps, num_steps, HARNESS_ITERATIONS), "the scenario is loaded");
+
+    scenario_start(&sc);
+    harness_check(scenario_running(&sc), "the scenario runs once started");
+    harness_check(!scenario_load(&sc, steps, num_steps, 1UL), "a running scenario is not reloaded");
+
+    passes = harness_run(&sched, HARNESS_MAX_PASSES);
+    harness_check((passes < HARNESS_MAX_PASSES) && (0UL == harness_lost_calls), "the scenario ends");
+
+    for (uint32_t it = 1UL; order_ok && (it <= HARNESS_ITERATIONS); it++)
+    {
+        for (uint32_t i = 0UL; order_ok && (i < HARNESS_COUNT(expected)); i++, call++)
+        {
+            order_ok = (call < harness_num_calls) && (expected[i].kind == harness_calls[call].kind) &&
+                       (expected[i].arg == harness_calls[call].arg);
+        }
+
+        /* The Deep Sleep step starts after the 3 ms dwell that follows the work */
+        dwell_ok = dwell_ok && order_ok &&
+                   ((harness_calls[call - 2UL].start_us - harness_calls[call - 3UL].end_us) >=
+                    (3UL * HARNESS_US_PER_TICK) - HARNESS_US_PER_TICK);
+
+        order_ok = order_ok && (call < harness_num_calls) &&
+                   (HARNESS_CALL_ITERATION == harness_calls[call].kind) && (it == harness_calls[call].arg);
+        call++;
+    }
+    harness_check(order_ok, "the steps run in order in every iteration");
+    harness_check(dwell_ok, "a dwell idles between its neighbouring steps");
+
+    harness_check((call < harness_num_calls) && (HARNESS_CALL_DONE == harness_calls[call].kind) &&
+                  ((call + 1UL) == harness_num_calls),
+                  "the end of the scenario is reported once, after the last iteration");
+    harness_check((call < harness_num_calls) && (0UL == harness_calls[call].arg) && !scenario_running(&sc),
+                  "the scenario is not running at and after its end");
+    harness_check(NULL == sched.timers, "no timer is left running");
+
+    (void)harness_run(&sched, 10UL);
+    harness_check((call + 1UL) == harness_num_calls, "nothing runs after the end");
+
+    harness_check((HARNESS_ITERATIONS == sc.stats[0].runs) && (HARNESS_ITERATIONS == sc.stats[4].runs) &&
+                  (0UL == sc.stats[0].failures) && (HARNESS_ITERATIONS == sc.stats[4].failures),
+                  "runs and failures are counted per step");
+    harness_check((HARNESS_MODE_US == sc.stats[0].min_us) && (HARNESS_MODE_US == sc.stats[0].max_us) &&
+                  (HARNESS_WORK_US == sc.stats[1].max_us) && (HARNESS_DS_US == sc.stats[3].max_us),
+                  "the latency is the time beyond the nominal duration");
+
+    (void)scenario_format_step(&sc, 0UL, line, sizeof(line));
+    harness_check(0 == strcmp(line, "SCN,0,mode,hp,3,0,50,50,50\r\n"), "a mode step is formatted");
+    (void)scenario_format_step(&sc, 3UL, line, sizeof(line));
+    harness_check(0 == strcmp(line, "SCN,3,ds,4,3,0,120,120,120\r\n"), "a timed step is formatted");
+    harness_check(scenario_format_step(&sc, num_steps, line, sizeof(line)) < 0,
+                  "a step past the table is not formatted");
+}
+
+/*******************************************************************************
+* Function Name: harness_stop_test
+********************************************************************************
+* Summary:
+*  Checks that a stopped scenario runs no further steps and does not report
+*  its end.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void harness_stop_test(void)
+{
+    static scenario_t sc;
+    scenario_hooks_t hooks =
+    {
+        .set_mode = harness_set_mode,
+        .work = harness_work,
+        .deep_sleep = harness_deep_sleep,
+        .now_us = harness_now_us_get,
+        .iteration_done = NULL,
+        .done = harness_done,
+        .arg = &sc,
+        .tick_hz = HARNESS_TICK_HZ
+    };
+    scenario_step_t steps[SCENARIO_MAX_STEPS];
+    event_sched_t sched;
+    uint32_t num_steps;
+    uint32_t calls;
+
+    harness_reset();
+    event_sched_init(&sched, &harness_port);
+    scenario_init(&sc, &sched, &hooks);
+    (void)scenario_parse("hp dwell 5 lp", steps, SCENARIO_MAX_STEPS, &num_steps, NULL);
+    (void)scenario_load(&sc, steps, num_steps, HARNESS_ITERATIONS);
+
+    /* The first pass switches the mode and starts the dwell */
+    scenario_start(&sc);
+    (void)harness_run(&sched, 1UL);
+    calls = harness_num_calls;
+    scenario_stop(&sc);
+    (void)harness_run(&sched, 10UL);
+
+    harness_check((1UL == calls) && (calls == harness_num_calls) && !scenario_running(&sc) &&
+                  (NULL == sched.timers), "a stopped scenario runs no further steps and does not end");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs all checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int
+*
+*******************************************************************************/
+int main(void)
+{
+    harness_parse_test();
+    harness_order_test();
+    harness_stop_test();
+
+    printf("%lu failures\n", (unsigned long)harness_failures);
+
+    return (0UL == harness_failures) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+################################################################################
+# \file sram_bank_report.py
+# \version 1.0
+#
+# \brief
+# Reports the SRAM macros and SOCMEM space used by the allocated sections of
+# one or more linked images. Used as a post-build step to choose the masks
+# passed to Cy_USER_SysSetSramPower.
+#
+# Usage: sram_bank_report.py <image.elf> [<image.elf> ...]
+#
+################################################################################
+# \copyright
+# (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import os
+import struct
+import sys
+
+# Must match CY_USER_SYSPM_SRAM_* in user_srf/user_syspm_srf.h
+SRAM_BASE_NS = 0x24000000
+SECURE_ALIAS_MSK = 0x10000000
+SRAM_MACRO_SIZE = 0x10000
+SRAM_MACROS = 16
+
+SOCMEM_BASE_NS = 0x26000000
+SOCMEM_SIZE = 0x500000
+
+SHF_ALLOC = 0x2
+
+
+def read_sections(path):
+    """Returns (name, address, size) of every allocated section of an ELF32 file."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[:4] != b"\x7fELF" or data[4] != 1:
+        raise ValueError("%s is not an ELF32 file" % path)
+
+    endian = "<" if data[5] == 1 else ">"
+    shoff, = struct.unpack_from(endian + "I", data, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", data, 0x2E)
+
+    headers = [struct.unpack_from(endian + "IIIIIIIIII", data, shoff + i * shentsize)
+               for i in range(shnum)]
+    strtab_off = headers[shstrndx][4]
+
+    sections = []
+    for name_off, _, flags, addr, _, size, _, _, _, _ in headers:
+        if (flags & SHF_ALLOC) and size:
+            end = data.index(b"\0", strtab_off + name_off)
+            sections.append((data[strtab_off + name_off:end].decode(), addr, size))
+
+    return sections
+
+
+def report(path):
+    macros = {}
+    socmem = []
+
+    for name, addr, size in read_sections(path):
+        offset = (addr & ~SECURE_ALIAS_MSK) - SRAM_BASE_NS
+        if 0 <= offset < SRAM_MACRO_SIZE * SRAM_MACROS:
+            for macro in range(offset // SRAM_MACRO_SIZE, (offset + size - 1) // SRAM_MACRO_SIZE + 1):
+                macros.setdefault(macro, []).append(name)
+            continue
+
+        offset = (addr & ~SECURE_ALIAS_MSK) - SOCMEM_BASE_NS
+        if 0 <= offset < SOCMEM_SIZE:
+            socmem.append((name, offset, size))
+
+    mask = 0
+    for macro in macros:
+        mask |= 1 << macro
+
+    print("%s:" % os.path.basename(path))
+    print("  SRAM macros used: 0x%04X" % mask)
+    for macro in sorted(macros):
+        print("    SRAM%d macro %d  %-8s %s" % (macro // 8, macro % 8,
+                                                "0x%05X" % (macro * SRAM_MACRO_SIZE),
+                                                " ".join(sorted(set(macros[macro])))))
+    if socmem:
+        print("  SOCMEM used: %d bytes" % sum(size for _, _, size in socmem))
+        for name, offset, size in socmem:
+            print("    0x%06X  %8d  %s" % (offset, size, name))
+
+    return mask
+
+
+def main(argv):
+    if len(argv) < 2:
+        print("Usage: sram_bank_report.py <image.elf> [<image.elf> ...]")
+        return 1
+
+    total = 0
+    for path in argv[1:]:
+        total |= report(path)
+
+    if len(argv) > 2:
+        print("All images: SRAM macros used 0x%04X, unused 0x%04X" %
+              (total, ~total & ((1 << SRAM_MACROS) - 1)))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
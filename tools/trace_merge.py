@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+################################################################################
+# \file trace_merge.py
+# \version 1.0
+#
+# \brief
+# Merges the event traces of the CM33 secure, CM33 non-secure and CM55 images
+# built with TRACE_TIMELINE=1 into one timeline. The trace buffers are found
+# in a binary dump of the m33_m55_shared memory region, the events are named
+# with the dictionary shared/trace_events.def. Writes a Chrome trace JSON file
+# that opens in Perfetto or chrome://tracing, and prints the duration
+# histogram of every event, including the doorbell ring to acknowledge latency
+# between the cores.
+#
+# Usage: trace_merge.py <trace_events.def> <shared.bin> [<trace.json>]
+#        The dump is taken with the debugger, for example
+#        "dump binary memory shared.bin <start> <end>" in GDB.
+#
+################################################################################
+# \copyright
+# (c) 2023-2026, Infineon Technologies AG, or an affiliate of Infineon
+# Technologies AG.  SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import json
+import re
+import struct
+import sys
+
+# Must match shared/trace_buf.h and IPC_TRACE_* in shared/ipc_shared.h
+BUF_MAGIC = 0x54524342
+BUF_VERSION = 1
+BUF_ALIGN = 32
+BUF_HEADER = struct.Struct("<8I")
+REC = struct.Struct("<IIHHI")
+PHASE_BEGIN, PHASE_END, PHASE_INSTANT = 0, 1, 2
+CORES = {0: "CM33 secure", 1: "CM33 non-secure", 2: "CM55"}
+
+TS_WRAP = 1 << 32
+ENTRY = re.compile(r"TRACE_EVENT\(\s*(\w+)\s*,\s*\"([^\"]*)\"\s*,\s*\"(\w*)\"\s*\)")
+
+
+def read_dictionary(path):
+    """Returns (name, label, argument name) for every event, in ID order."""
+    with open(path, "r", encoding="utf-8") as f:
+        text = re.sub(r"/\*.*?\*/", "", f.read(), flags=re.S)
+
+    return ENTRY.findall(text)
+
+
+def read_buffers(data):
+    """Returns (core, hz, records) for every trace buffer in the dump. Records
+    are (seq, ts, event, phase, arg) in write order."""
+    buffers = []
+    pos = 0
+
+    while True:
+        pos = data.find(struct.pack("<I", BUF_MAGIC), pos)
+        if pos < 0:
+            return buffers
+        if pos % BUF_ALIGN or pos + BUF_HEADER.size > len(data):
+            pos += 1
+            continue
+
+        _, version, core, hz, count, head, _, _ = BUF_HEADER.unpack_from(data, pos)
+        size = BUF_HEADER.size + count * REC.size
+        if (version != BUF_VERSION or not hz or not count or count & (count - 1) or
+                pos + size > len(data)):
+            pos += 1
+            continue
+
+        recs = []
+        for seq in range(max(0, head - count), head):
+            rec = REC.unpack_from(data, pos + BUF_HEADER.size + (seq & (count - 1)) * REC.size)
+            # Skipped if it was being written when the dump was taken
+            if rec[0] == seq:
+                recs.append(rec)
+
+        buffers.append((core, hz, recs))
+        pos += size
+
+
+def unwrap(recs, hz):
+    """Returns the records with the time stamps in microseconds, unwrapped over
+    the 32-bit counter assuming less than a full wrap between records."""
+    out = []
+    last = None
+    base = 0
+
+    for seq, ts, event, phase, arg in recs:
+        if last is not None and ts < last and last - ts > TS_WRAP // 2:
+            base += TS_WRAP
+        last = ts
+        out.append(((base + ts) * 1000000.0 / hz, event, phase, arg))
+
+    return out
+
+
+def histogram(name, durations, out):
+    """Prints the count, range and log2 microsecond buckets of the durations."""
+    buckets = {}
+    for d in durations:
+        bucket = max(0, int(d).bit_length())
+        buckets[bucket] = buckets.get(bucket, 0) + 1
+
+    out.write("%s: %d, min %.0f us, avg %.0f us, max %.0f us\n" %
+              (name, len(durations), min(durations), sum(durations) / len(durations), max(durations)))
+    for bucket in sorted(buckets):
+        low = 0 if bucket == 0 else 1 << (bucket - 1)
+        out.write("  %8d us  %6d  %s\n" % (low, buckets[bucket],
+                                            "#" * ((buckets[bucket] * 40 + len(durations) - 1) // len(durations))))
+
+
+def merge(events, buffers, out):
+    """Returns the Chrome trace events and prints the duration histograms."""
+    trace = []
+    durations = {}
+    rings = {}
+    latency = []
+
+    for core, hz, recs in buffers:
+        trace.append({"name": "thread_name", "ph": "M", "pid": 0, "tid": core,
+                      "args": {"name": CORES.get(core, "core %d" % core)}})
+        open_events = {}
+
+        for us, event, phase, arg in unwrap(recs, hz):
+            name, label, arg_name = events[event] if event < len(events) else \
+                ("EVENT_%d" % event, "Event %d" % event, "arg")
+            entry = {"name": label, "pid": 0, "tid": core, "ts": us}
+            if arg_name:
+                entry["args"] = {arg_name: arg}
+
+            if phase == PHASE_BEGIN:
+                entry["ph"] = "B"
+                open_events.setdefault(event, []).append(us)
+            elif phase == PHASE_END:
+                entry["ph"] = "E"
+                # A buffer that wrapped can start with the end of an event
+                if open_events.get(event):
+                    durations.setdefault(label, []).append(us - open_events[event].pop())
+            else:
+                entry["ph"] = "i"
+                entry["s"] = "t"
+                if name == "IPC_RING":
+                    rings.setdefault(arg, []).append(us)
+                elif name == "IPC_ACK":
+                    latency.append((us, arg))
+            trace.append(entry)
+
+    # Every acknowledge is matched with the last ring of the same doorbell
+    # before it, a ring coalesced with a pending one has no acknowledge
+    for us, bell in latency:
+        before = sorted(r for r in rings.get(bell, []) if r <= us)
+        if before:
+            durations.setdefault("Doorbell %d ring to ack" % bell, []).append(us - before[-1])
+
+    for label in sorted(durations):
+        histogram(label, durations[label], out)
+
+    trace.sort(key=lambda e: e.get("ts", -1))
+    return trace
+
+
+def main(argv):
+    if len(argv) not in (3, 4):
+        print("Usage: trace_merge.py <trace_events.def> <shared.bin> [<trace.json>]")
+        return 1
+
+    events = read_dictionary(argv[1])
+    with open(argv[2], "rb") as f:
+        buffers = read_buffers(f.read())
+
+    if not buffers:
+        print("No trace buffers found, was the image built with TRACE_TIMELINE=1?")
+        return 1
+
+    for core, hz, recs in buffers:
+        print("%s: %d records at %d Hz" % (CORES.get(core, "core %d" % core), len(recs), hz))
+
+    trace = merge(events, buffers, sys.stdout)
+
+    if len(argv) == 4:
+        with open(argv[3], "w", encoding="utf-8") as f:
+            json.dump({"traceEvents": trace, "displayTimeUnit": "ms"}, f)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -71,6 +71,9 @@ CY_SECTION_SHAREDMEM _MTB_SRF_DATA_ALIGN uint32_t cy_user_srf_default_pool_memor
                                                                                    MTB_SRF_POOL_SIZE) /
                                                                                   sizeof(uint32_t)];
 
+/* Lock serializing the requests, none in a bare-metal application */
+static const cy_stc_user_srf_lock_t* cy_user_srf_lock_hooks = NULL;
+
 #endif /* defined(COMPONENT_SECURE_DEVICE) */
 
 
@@ -90,6 +93,51 @@ cy_rslt_t cy_user_srf_module_pool_init(void)
                                MTB_SRF_MAX_ARG_IN_SIZE, MTB_SRF_MAX_ARG_OUT_SIZE);
 }
 
+void cy_user_srf_set_lock(const cy_stc_user_srf_lock_t* lock)
+{
+    cy_user_srf_lock_hooks = lock;
+}
+
+void cy_user_srf_lock(void)
+{
+    if (NULL != cy_user_srf_lock_hooks)
+    {
+        cy_user_srf_lock_hooks->acquire();
+    }
+}
+
+void cy_user_srf_unlock(void)
+{
+    if (NULL != cy_user_srf_lock_hooks)
+    {
+        cy_user_srf_lock_hooks->release();
+    }
+}
+
+cy_rslt_t cy_user_srf_pool_allocate(mtb_srf_invec_ns_t** inVec, mtb_srf_outvec_ns_t** outVec)
+{
+    cy_rslt_t result;
+
+    cy_user_srf_lock();
+
+    result = mtb_srf_pool_allocate(&cy_user_srf_default_pool, inVec, outVec, CY_USER_SYSPM_SRF_POOL_TIMEOUT);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        cy_user_srf_unlock();
+    }
+
+    return result;
+}
+
+cy_rslt_t cy_user_srf_pool_free(mtb_srf_invec_ns_t* inVec, mtb_srf_outvec_ns_t* outVec)
+{
+    cy_rslt_t result = mtb_srf_pool_free(&cy_user_srf_default_pool, inVec, outVec);
+
+    cy_user_srf_unlock();
+
+    return result;
+}
+
 cy_rslt_t Cy_USER_Invoke_SRF(cy_user_invoke_srf_args* args)
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
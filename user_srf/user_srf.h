@@ -60,6 +60,15 @@ typedef struct
     size_t*                 outvec_sizes;   /**< Size of outVec[1]. Ignored if outvec1_base is NULL. */
 } cy_user_invoke_srf_args;
 
+/** Lock serializing the USER module requests when they are made from more
+ * than one thread. The lock must be recursive: a power mode transition holds
+ * it while its notifiers and its SRF request take it again. */
+typedef struct
+{
+    void (*acquire)(void);      /**< Takes the lock, blocking */
+    void (*release)(void);      /**< Gives the lock back */
+} cy_stc_user_srf_lock_t;
+
 #endif
 
 /* Ordering in this enum must exactly match ordering in cy_user_srf_operations and cy_user_srf_num_operations*/
@@ -117,4 +126,81 @@ cy_rslt_t cy_user_srf_module_pool_init(void);
 *******************************************************************************/
 cy_rslt_t Cy_USER_Invoke_SRF(cy_user_invoke_srf_args* args);
 
+/*******************************************************************************
+* Function Name: cy_user_srf_set_lock
+****************************************************************************//**
+*
+* Sets the lock used to serialize the USER module requests. Without a lock,
+* as in a bare-metal application, requests must not be made concurrently.
+*
+* \param lock Lock hooks, must stay valid. NULL removes the lock.
+
+* \return
+* None
+*
+*******************************************************************************/
+void cy_user_srf_set_lock(const cy_stc_user_srf_lock_t* lock);
+
+/*******************************************************************************
+* Function Name: cy_user_srf_lock
+****************************************************************************//**
+*
+* Takes the USER module lock, if one is set. Used to keep a sequence of
+* requests and the state they update together.
+*
+* \param none
+
+* \return
+* None
+*
+*******************************************************************************/
+void cy_user_srf_lock(void);
+
+/*******************************************************************************
+* Function Name: cy_user_srf_unlock
+****************************************************************************//**
+*
+* Gives back the USER module lock taken with cy_user_srf_lock.
+*
+* \param none
+
+* \return
+* None
+*
+*******************************************************************************/
+void cy_user_srf_unlock(void);
+
+/*******************************************************************************
+* Function Name: cy_user_srf_pool_allocate
+****************************************************************************//**
+*
+* Takes the USER module lock and allocates an entry of the default pool. On
+* success the lock is held until the entry is freed with
+* cy_user_srf_pool_free, so the request in between is serialized as well.
+*
+* \param inVec Returns the input vectors of the entry
+* \param outVec Returns the output vectors of the entry
+
+* \return
+* Status of the allocation.
+*
+*******************************************************************************/
+cy_rslt_t cy_user_srf_pool_allocate(mtb_srf_invec_ns_t** inVec, mtb_srf_outvec_ns_t** outVec);
+
+/*******************************************************************************
+* Function Name: cy_user_srf_pool_free
+****************************************************************************//**
+*
+* Frees an entry allocated with cy_user_srf_pool_allocate and gives back the
+* USER module lock.
+*
+* \param inVec Input vectors of the entry
+* \param outVec Output vectors of the entry
+
+* \return
+* Status of the release.
+*
+*******************************************************************************/
+cy_rslt_t cy_user_srf_pool_free(mtb_srf_invec_ns_t* inVec, mtb_srf_outvec_ns_t* outVec);
+
 #endif /* defined(COMPONENT_SECURE_DEVICE)*/
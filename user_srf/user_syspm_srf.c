@@ -30,9 +30,13 @@
 #include "cy_gpio.h"
 #include "cybsp.h"
 #include "ifx_se_platform.h"
+#if defined(COMPONENT_SECURE_DEVICE)
+#include <arm_cmse.h>
+#endif /* defined(COMPONENT_SECURE_DEVICE) */
 
 #include "user_srf.h"
 #include "user_syspm_srf.h"
+#include "trace.h"
 /*******************************************************************************
 *    Secure Aware Support
 *******************************************************************************/
@@ -42,6 +46,301 @@
 #define UART_LP_DIV                   (26U)
 #define UART_ULP_DIV                  (10U)
 
+/* Typical wake-up latency of each Deep Sleep depth in microseconds. DS-OFF
+ * includes the boot up to the secure application. */
+#define DS_WAKEUP_US                  (20U)
+#define DS_RAM_WAKEUP_US              (150U)
+#define DS_OFF_WAKEUP_US              (2000U)
+
+/* SOCMEM needs no restore when retained, otherwise its power-up is counted */
+#define SOCMEM_RETAINED_WAKEUP_US     (5U)
+#define SOCMEM_OFF_WAKEUP_US          (50U)
+
+/* Backup-domain registers lent to the non-secure side. The backup domain stays
+ * powered in DS-OFF and Hibernate. The lower register sets are left to the
+ * boot code. */
+#define USER_SYSPM_BACKUP_REG         (BACKUP->BREG_SET3)
+
+/* Deep Sleep depth of each domain, as last configured */
+static cy_stc_user_syspm_ds_modes_t user_syspm_ds_modes =
+{
+    .sys_mode = (uint32_t)CY_SYSPM_MODE_DEEPSLEEP,
+    .app_mode = (uint32_t)CY_SYSPM_MODE_DEEPSLEEP,
+    .socmem_mode = (uint32_t)CY_SYSPM_MODE_DEEPSLEEP
+};
+
+static bool _Cy_USER_SysPm_IsValidDsMode(uint32_t mode)
+{
+    return (((uint32_t)CY_SYSPM_MODE_DEEPSLEEP == mode) ||
+            ((uint32_t)CY_SYSPM_MODE_DEEPSLEEP_RAM == mode) ||
+            ((uint32_t)CY_SYSPM_MODE_DEEPSLEEP_OFF == mode));
+}
+
+/* Hibernate wake-up sources, the only ones DS-OFF and Hibernate can wake up from */
+#define HIBERNATE_WAKEUP_SRC_MSK      ((uint32_t)CY_SYSPM_HIBERNATE_LPCOMP0_LOW |  \
+                                       (uint32_t)CY_SYSPM_HIBERNATE_LPCOMP0_HIGH | \
+                                       (uint32_t)CY_SYSPM_HIBERNATE_LPCOMP1_LOW |  \
+                                       (uint32_t)CY_SYSPM_HIBERNATE_LPCOMP1_HIGH | \
+                                       (uint32_t)CY_SYSPM_HIBERNATE_RTC_ALARM |    \
+                                       (uint32_t)CY_SYSPM_HIBERNATE_WDT |          \
+                                       (uint32_t)CY_SYSPM_HIBERNATE_PIN0_LOW |     \
+                                       (uint32_t)CY_SYSPM_HIBERNATE_PIN0_HIGH |    \
+                                       (uint32_t)CY_SYSPM_HIBERNATE_PIN1_LOW |     \
+                                       (uint32_t)CY_SYSPM_HIBERNATE_PIN1_HIGH)
+
+static bool _Cy_USER_SysPm_IsValidWakeupSrc(uint32_t wakeup_src)
+{
+    return (0UL == (wakeup_src & ~HIBERNATE_WAKEUP_SRC_MSK));
+}
+
+static uint32_t _Cy_USER_SysPm_DsWakeupUs(uint32_t mode)
+{
+    uint32_t latency_us = DS_WAKEUP_US;
+
+    if ((uint32_t)CY_SYSPM_MODE_DEEPSLEEP_RAM == mode)
+    {
+        latency_us = DS_RAM_WAKEUP_US;
+    }
+    else if ((uint32_t)CY_SYSPM_MODE_DEEPSLEEP_OFF == mode)
+    {
+        latency_us = DS_OFF_WAKEUP_US;
+    }
+
+    return latency_us;
+}
+
+/* MCUboot image header placed in front of the CM55 image */
+#define CM55_IMAGE_MAGIC              (0x96F3B83DUL)
+#define CM55_IMAGE_HDR_MAGIC          (0U)
+#define CM55_IMAGE_HDR_SIZE           (3U)
+
+/* CM55 boot address, after the MCUboot header */
+#define CM55_APP_BOOT_ADDR            (CYMEM_CM33_0_m55_nvm_START + CYBSP_MCUBOOT_HEADER_SIZE)
+
+/* CM55 state and the cached result of its boot image validation */
+static bool user_syspm_cm55_on = false;
+static bool user_syspm_cm55_validated = false;
+static bool user_syspm_cm55_image_ok = false;
+
+/* Deep Sleep depth applied to the application domain, powered off with the CM55 */
+static cy_en_syspm_deep_sleep_mode_t _Cy_USER_SysPm_AppDsMode(uint32_t mode)
+{
+    return user_syspm_cm55_on ? (cy_en_syspm_deep_sleep_mode_t)mode : CY_SYSPM_MODE_DEEPSLEEP_OFF;
+}
+
+/* Checks the MCUboot header and the vector table of the CM55 image. The image
+ * cannot change without a reset, so the result is cached by the caller. */
+static bool _Cy_USER_SysPm_Cm55ImageValid(void)
+{
+    const volatile uint32_t* header = (const volatile uint32_t*)CYMEM_CM33_0_m55_nvm_START;
+    const volatile uint32_t* vectors = (const volatile uint32_t*)CM55_APP_BOOT_ADDR;
+    uint32_t image_size = header[CM55_IMAGE_HDR_SIZE];
+
+    return ((CM55_IMAGE_MAGIC == header[CM55_IMAGE_HDR_MAGIC]) &&
+            (0UL != image_size) &&
+            (image_size <= (CYMEM_CM33_0_m55_nvm_SIZE - CYBSP_MCUBOOT_HEADER_SIZE)) &&
+            (0UL == (vectors[0] & 0x7UL)) &&    /* Initial stack pointer is 8-byte aligned */
+            (0UL != (vectors[1] & 0x1UL)));     /* Reset handler is a Thumb address */
+}
+
+/* SRAM regions that must stay powered, in either security alias. They come
+ * from the memory regions generated from design.modus. */
+typedef struct
+{
+    uint32_t addr;
+    uint32_t size;
+} user_syspm_sram_region_t;
+
+static const user_syspm_sram_region_t user_syspm_protected_sram[] =
+{
+    /* extended_boot_sram_reserved, the SRAM below the secure image */
+    { CY_USER_SYSPM_SRAM_BASE_NS,
+      (CYMEM_CM33_0_m33s_shared_START & ~CY_USER_SYSPM_SECURE_ALIAS_MSK) - CY_USER_SYSPM_SRAM_BASE_NS },
+    { CYMEM_CM33_0_m33s_shared_START, CYMEM_CM33_0_m33s_shared_SIZE },
+    { CYMEM_CM33_0_m33s_code_START, CYMEM_CM33_0_m33s_code_SIZE },
+    { CYMEM_CM33_0_m33s_data_START, CYMEM_CM33_0_m33s_data_SIZE },
+    /* Allocatable shared memory, holds the SRF pool (cy_user_srf_default_pool_memory) */
+    { CYMEM_CM33_0_m33s_allocatable_shared_START, CYMEM_CM33_0_m33s_allocatable_shared_SIZE },
+    { CYMEM_CM33_0_m33_allocatable_shared_START, CYMEM_CM33_0_m33_allocatable_shared_SIZE },
+    { CYMEM_CM33_0_m55_allocatable_shared_START, CYMEM_CM33_0_m55_allocatable_shared_SIZE },
+};
+
+/* SRAM macros powered in active modes and retained in Deep Sleep */
+static uint32_t user_syspm_sram_active_mask = CY_USER_SYSPM_SRAM_ALL_MACROS;
+static uint32_t user_syspm_sram_ds_mask = CY_USER_SYSPM_SRAM_ALL_MACROS;
+
+/* Returns the SRAM macros overlapping an address range of either security alias */
+static uint32_t _Cy_USER_SysPm_SramMacrosOf(uint32_t addr, uint32_t size)
+{
+    uint32_t offset = (addr & ~CY_USER_SYSPM_SECURE_ALIAS_MSK) - CY_USER_SYSPM_SRAM_BASE_NS;
+    uint32_t sram_size = 2UL * CY_USER_SYSPM_SRAM_MACROS_PER_BANK * CY_USER_SYSPM_SRAM_MACRO_SIZE;
+    uint32_t mask = 0UL;
+
+    if ((0UL != size) && (offset < sram_size))
+    {
+        uint32_t first = offset / CY_USER_SYSPM_SRAM_MACRO_SIZE;
+        uint32_t last = CY_MIN(offset + size - 1UL, sram_size - 1UL) / CY_USER_SYSPM_SRAM_MACRO_SIZE;
+
+        for (uint32_t macro = first; macro <= last; macro++)
+        {
+            mask |= (1UL << macro);
+        }
+    }
+
+    return mask;
+}
+
+static uint32_t _Cy_USER_SysPm_ProtectedSramMacros(void)
+{
+    uint32_t mask = 0UL;
+
+    for (uint32_t i = 0U; i < (sizeof(user_syspm_protected_sram) / sizeof(user_syspm_protected_sram[0])); i++)
+    {
+        mask |= _Cy_USER_SysPm_SramMacrosOf(user_syspm_protected_sram[i].addr, user_syspm_protected_sram[i].size);
+    }
+
+    return mask;
+}
+
+/* Applies the power mode of every SRAM macro, bit set keeps the macro powered */
+static void _Cy_USER_SysPm_SetSramMacros(uint32_t macro_mask)
+{
+    cy_en_syspm_sram_index_t sram;
+    cy_en_syspm_sram_pwr_mode_t pwr_mode;
+
+    for (uint32_t macro = 0U; macro < (2U * CY_USER_SYSPM_SRAM_MACROS_PER_BANK); macro++)
+    {
+        sram = (macro < CY_USER_SYSPM_SRAM_MACROS_PER_BANK) ? CY_SYSPM_SRAM0_MEMORY : CY_SYSPM_SRAM1_MEMORY;
+        pwr_mode = (0UL != (macro_mask & (1UL << macro))) ? CY_SYSPM_SRAM_PWR_MODE_ON : CY_SYSPM_SRAM_PWR_MODE_OFF;
+
+        (void)Cy_SysPm_SetSRAMMacroPwrMode(sram, macro % CY_USER_SYSPM_SRAM_MACROS_PER_BANK, pwr_mode);
+    }
+}
+
+/* Residency is accounted with the CM33 LPTimer, a free-running cascade of
+ * MCWDT counters 0 and 1 clocked by CLK_LF that keeps counting in Deep Sleep.
+ * It is started by the non-secure event scheduler. The MCWDT is a non-secure
+ * peripheral, so the non-secure side can reset the counter under the secure
+ * accounting; an interval over which it went backwards is discarded. */
+#define RESIDENCY_TIMER_HZ            (32768UL)
+
+/* Device current of each state in microamperes, used to estimate the charge.
+ * Indexed like the residency arrays: HP, LP, ULP, Deep Sleep. The values are
+ * placeholders of a plausible order of magnitude for the default clocks of the
+ * board, not datasheet or measured figures. Replace them with measurements of
+ * the actual application before relying on the charge estimate. */
+#if defined(TARGET_KIT_PSE84_EVAL_EPC4) || defined(TARGET_APP_KIT_PSE84_EVAL_EPC4)
+#define RESIDENCY_CURRENT_UA          { 19500UL, 7200UL, 2100UL, 36UL }
+#else
+#define RESIDENCY_CURRENT_UA          { 18000UL, 6500UL, 1900UL, 28UL }
+#endif
+
+static const uint32_t user_syspm_res_current_ua[CY_USER_SYSPM_RESIDENCY_STATES] = RESIDENCY_CURRENT_UA;
+
+/* Residency counters. The ticks of the current state are added on the next
+ * state change or read. */
+static uint64_t user_syspm_res_ticks[CY_USER_SYSPM_RESIDENCY_STATES];
+static uint32_t user_syspm_res_entries[CY_USER_SYSPM_RESIDENCY_STATES];
+static uint32_t user_syspm_res_failures = 0UL;
+static uint32_t user_syspm_res_discarded = 0UL;
+static uint32_t user_syspm_res_state = (uint32_t)CY_USER_SYSPM_MODE_HP;
+static uint32_t user_syspm_res_active = (uint32_t)CY_USER_SYSPM_MODE_HP;
+static uint32_t user_syspm_res_mark = 0UL;
+
+/* Adds the time since the last call to the current state and switches to the
+ * new one. Waking up from Deep Sleep returns to the active mode without
+ * counting an entry. A counter below the last mark was reset, or wrapped, and
+ * the interval cannot be known, so it is discarded. */
+static void _Cy_USER_SysPm_ResidencySwitch(uint32_t state, bool entry)
+{
+    uint32_t now = Cy_MCWDT_GetCountCascaded(CYBSP_CM33_LPTIMER_0_HW);
+
+    if (now >= user_syspm_res_mark)
+    {
+        user_syspm_res_ticks[user_syspm_res_state] += (uint64_t)(now - user_syspm_res_mark);
+    }
+    else
+    {
+        user_syspm_res_discarded++;
+    }
+    user_syspm_res_mark = now;
+    user_syspm_res_state = state;
+
+    if (CY_USER_SYSPM_RESIDENCY_DS != state)
+    {
+        user_syspm_res_active = state;
+    }
+
+    if (entry)
+    {
+        user_syspm_res_entries[state]++;
+    }
+}
+
+/* RRAM voltage mode of each system power mode, as applied by the transition
+ * callbacks of the secure application */
+static const uint32_t user_syspm_rram_vmode[] =
+{
+    (uint32_t)CY_RRAM_VMODE_HP,
+    (uint32_t)CY_RRAM_VMODE_LP,
+    (uint32_t)CY_RRAM_VMODE_ULP
+};
+
+/* The Secure Enclave is disabled around the Deep Sleep entries */
+static bool user_syspm_se_enabled = true;
+
+static void _Cy_USER_SysPm_SeDisable(void)
+{
+    ifx_se_disable(NULL);
+    user_syspm_se_enabled = false;
+}
+
+static void _Cy_USER_SysPm_SeEnable(void)
+{
+    ifx_se_enable(NULL);
+    user_syspm_se_enabled = true;
+}
+
+/* Telemetry page registered by the non-secure side and its counters */
+static volatile cy_stc_user_syspm_telemetry_page_t* user_syspm_telemetry = NULL;
+static uint32_t user_syspm_tlm_transitions = 0UL;
+static uint32_t user_syspm_tlm_ds_entries = 0UL;
+
+/* Publishes the power state. Readers use the copy selected by the low bit of
+ * seq, so each copy is only written while the other one is selected. */
+static void _Cy_USER_SysPm_PublishTelemetry(void)
+{
+    cy_stc_user_syspm_telemetry_t state;
+    uint32_t seq;
+
+    if (NULL == user_syspm_telemetry)
+    {
+        return;
+    }
+
+    SystemCoreClockUpdate();
+
+    state.mode = (uint32_t)Cy_USER_SysGetPowerMode();
+    state.core_hz = SystemCoreClock;
+    state.clkhf0_hz = Cy_SysClk_ClkHfGetFrequency(CY_CFG_SYSCLK_CLKHF0);
+    state.rram_vmode = user_syspm_rram_vmode[state.mode];
+    state.transitions = user_syspm_tlm_transitions;
+    state.ds_entries = user_syspm_tlm_ds_entries;
+    state.updated = Cy_MCWDT_GetCountCascaded(CYBSP_CM33_LPTIMER_0_HW);
+    state.reserved = 0UL;
+
+    seq = user_syspm_telemetry->seq;
+
+    user_syspm_telemetry->seq = seq + 1UL;
+    __DMB();
+    user_syspm_telemetry->copy[0] = state;
+    __DMB();
+    user_syspm_telemetry->seq = seq + 2UL;
+    __DMB();
+    user_syspm_telemetry->copy[1] = state;
+    __DMB();
+}
+
 
 cy_rslt_t cy_user_syspm_srf_enterhighperformance_impl_s(mtb_srf_input_ns_t* inputs_ns,
                                             mtb_srf_output_ns_t* outputs_ns,
@@ -127,225 +426,1703 @@ cy_rslt_t cy_user_syspm_srf_enterdeepsleep_impl_s(mtb_srf_input_ns_t* inputs_ns,
     return (cy_rslt_t)CY_RSLT_SUCCESS;
 }
 
-/* All operations for the SYSPM submodule of the USER module */
-mtb_srf_op_s_t _cy_user_syspm_srf_operations[] =
+cy_rslt_t cy_user_syspm_srf_enterdeepsleepram_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
 {
-    {
-        .module_id = MTB_SRF_MODULE_USER,
-        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
-        .op_id = CY_USER_SYSPM_OP_ENTERHIGHPERFORMANCE,
-        .write_required = false,
-        .impl = cy_user_syspm_srf_enterhighperformance_impl_s,
-        .input_values_len = 0UL,
-        .output_values_len = 0UL,
-        .input_len ={ 0UL, 0UL, 0UL },
-        .needs_copy = { false, false, false },
-        .output_len ={ 0UL, 0UL, 0UL },
-        .allowed_rsc = NULL,
-        .num_allowed = 0UL,
-    },
-    {
-        .module_id = MTB_SRF_MODULE_USER,
-        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
-        .op_id = CY_USER_SYSPM_OP_ENTERLOWPOWER,
-        .write_required = false,
-        .impl = cy_user_syspm_srf_enterlowpower_impl_s,
-        .input_values_len = 0UL,
-        .output_values_len = 0UL,
-        .input_len ={ 0UL, 0UL, 0UL },
-        .needs_copy = { false, false, false },
-        .output_len ={ 0UL, 0UL, 0UL },
-        .allowed_rsc = NULL,
-        .num_allowed = 0UL,
-    },
-    {
-        .module_id = MTB_SRF_MODULE_USER,
-        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
-        .op_id = CY_USER_SYSPM_OP_ENTERULTRALOWPOWER,
-        .write_required = false,
-        .impl = cy_user_syspm_srf_enterultralowpower_impl_s,
-        .input_values_len = 0UL,
-        .output_values_len = 0UL,
-        .input_len ={ 0UL, 0UL, 0UL },
-        .needs_copy = { false, false, false },
-        .output_len ={ 0UL, 0UL, 0UL },
-        .allowed_rsc = NULL,
-        .num_allowed = 0UL,
-    },
-    {
-        .module_id = MTB_SRF_MODULE_USER,
-        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
-        .op_id = CY_USER_SYSPM_OP_ENTERDEEPSLEEP,
-        .write_required = false,
-        .impl = cy_user_syspm_srf_enterdeepsleep_impl_s,
-        .input_values_len = 0UL,
-        .output_values_len = 0UL,
-        .input_len ={ 0UL, 0UL, 0UL },
-        .needs_copy = { false, false, false },
-        .output_len ={ 0UL, 0UL, 0UL },
-        .allowed_rsc = NULL,
-        .num_allowed = 0UL,
-    }
-};
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_cnt_ns);
+    cy_rslt_t retVal;
+    cy_stc_user_syspm_ds_cfg_t config;
 
+    memcpy(&config, &inputs_ns->input_values[0], sizeof(config));
 
-#else
+    retVal = Cy_USER_SysEnterDSRam(&config);
 
-void _Cy_USER_SysPm_Invoke_SRF(cy_user_syspm_srf_op_id_t op_id, cy_en_user_syspm_status_t* retval)
-{
-    cy_rslt_t result;
-    CY_UNUSED_PARAMETER(result);
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
 
-    mtb_srf_invec_ns_t* inVec = NULL;
-    mtb_srf_outvec_ns_t* outVec = NULL;
-    mtb_srf_output_ns_t* output = NULL;
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
+}
 
-    result = mtb_srf_pool_allocate(&cy_user_srf_default_pool, &inVec, &outVec, CY_USER_SYSPM_SRF_POOL_TIMEOUT);
-    CY_ASSERT_L2(result == CY_RSLT_SUCCESS);
+cy_rslt_t cy_user_syspm_srf_enterdeepsleepoff_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
+{
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_cnt_ns);
+    cy_rslt_t retVal;
+    cy_stc_user_syspm_ds_cfg_t config;
 
-    cy_user_invoke_srf_args invoke_args =
-    {
-        .inVec = inVec,
-        .outVec = outVec,
-        .output_ptr = &output,
-        .op_id = op_id,
-        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
-        .base = NULL,
-        .sub_block = 0UL,
-        .input_base = NULL,
-        .input_len = 0UL,
-        .output_base = (uint8_t*)retval,
-        .output_len = sizeof(*retval),
-        .invec_bases = NULL,
-        .invec_sizes = 0UL,
-        .outvec_bases = NULL,
-        .outvec_sizes = 0UL
-    };
+    memcpy(&config, &inputs_ns->input_values[0], sizeof(config));
 
-    (void)Cy_USER_Invoke_SRF(&invoke_args);
+    retVal = Cy_USER_SysEnterDSOff(&config);
 
-    result = mtb_srf_pool_free(&cy_user_srf_default_pool, inVec, outVec);
-    CY_ASSERT_L2(result == CY_RSLT_SUCCESS);
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
 
-    memcpy(retval, &(output->output_values[0]), sizeof(*retval));
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
 }
 
-#endif /* defined(COMPONENT_SECURE_DEVICE) */
-
-cy_en_user_syspm_status_t Cy_USER_SysEnterHp(void)
+cy_rslt_t cy_user_syspm_srf_enterhibernate_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
 {
-    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_cnt_ns);
+    cy_rslt_t retVal;
+    cy_stc_user_syspm_ds_cfg_t config;
 
-#if defined(COMPONENT_SECURE_DEVICE)
+    memcpy(&config, &inputs_ns->input_values[0], sizeof(config));
 
-    cy_en_syspm_status_t status;
+    retVal = Cy_USER_SysEnterHibernate(&config);
 
-    status = Cy_SysPm_SystemEnterHp();
-    if ((CY_SYSPM_SUCCESS == status) && Cy_SysPm_IsSystemHp())
-    {
-        /** Set the high-frequency clock (CLKHF) divide */
-        Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0, CY_SYSCLK_CLKHF_DIVIDE_BY_2);
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
 
-        /** Adjust the peripheral clock divider for the debug UART */
-        Cy_SysClk_PeriPclkSetDivider((en_clk_dst_t)CYBSP_DEBUG_UART_CLK_DIV_GRP_NUM,
-                                     CY_SYSCLK_DIV_16_BIT, 1U, UART_HP_DIV);
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
+}
 
-        result = CY_USER_SYSPM_SUCCESS;
-    }
+cy_rslt_t cy_user_syspm_srf_setbackup_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
+{
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_cnt_ns);
+    cy_rslt_t retVal;
+    cy_stc_user_syspm_backup_t backup;
 
-#else
+    memcpy(&backup, &inputs_ns->input_values[0], sizeof(backup));
 
-    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_ENTERHIGHPERFORMANCE, &result);
+    retVal = Cy_USER_SysSetBackup(&backup);
 
-#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
 
-    return result;
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
 }
 
-cy_en_user_syspm_status_t Cy_USER_SysEnterLp(void)
+cy_rslt_t cy_user_syspm_srf_getbackup_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
 {
-    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+    CY_UNUSED_PARAMETER(inputs_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    cy_rslt_t retVal = CY_USER_SYSPM_BAD_PARAM;
+    cy_stc_user_syspm_backup_t backup;
 
-#if defined(COMPONENT_SECURE_DEVICE)
+    if ((outputs_ptr_cnt_ns >= 1U) && (outputs_ptr_ns[0].len == sizeof(backup)))
+    {
+        retVal = Cy_USER_SysGetBackup(&backup);
+
+        memcpy(outputs_ptr_ns[0].base, &backup, sizeof(backup));
+    }
+
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
+
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_user_syspm_srf_setdeepsleepmodes_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
+{
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    cy_rslt_t retVal = CY_USER_SYSPM_BAD_PARAM;
+    cy_stc_user_syspm_ds_modes_t modes;
+    cy_stc_user_syspm_ds_latency_t latency;
+
+    memcpy(&modes, &inputs_ns->input_values[0], sizeof(modes));
+
+    if ((outputs_ptr_cnt_ns >= 1U) && (outputs_ptr_ns[0].len == sizeof(latency)))
+    {
+        retVal = Cy_USER_SysSetDeepSleepModes(&modes, &latency);
+
+        memcpy(outputs_ptr_ns[0].base, &latency, sizeof(latency));
+    }
+
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
+
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_user_syspm_srf_setsrampower_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
+{
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    cy_rslt_t retVal = CY_USER_SYSPM_BAD_PARAM;
+    cy_stc_user_syspm_sram_cfg_t config;
+    uint32_t protected_mask = 0UL;
+    uint32_t pool_mask;
+
+    memcpy(&config, &inputs_ns->input_values[0], sizeof(config));
+
+    /* The pool entry carrying this request must survive it as well */
+    pool_mask = _Cy_USER_SysPm_SramMacrosOf((uint32_t)inputs_ns, (uint32_t)sizeof(*inputs_ns)) |
+                _Cy_USER_SysPm_SramMacrosOf((uint32_t)outputs_ns, (uint32_t)sizeof(*outputs_ns));
+
+    if ((outputs_ptr_cnt_ns >= 1U) && (outputs_ptr_ns[0].len == sizeof(protected_mask)) &&
+        ((config.ds_retain_mask & pool_mask) == pool_mask))
+    {
+        retVal = Cy_USER_SysSetSramPower(&config, &protected_mask);
+
+        memcpy(outputs_ptr_ns[0].base, &protected_mask, sizeof(protected_mask));
+    }
+
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
+
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_user_syspm_srf_cm55poweroff_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
+{
+    CY_UNUSED_PARAMETER(inputs_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_cnt_ns);
+    cy_rslt_t retVal;
+
+    retVal = Cy_USER_SysCm55PowerOff();
+
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
+
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_user_syspm_srf_cm55poweron_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
+{
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    cy_rslt_t retVal = CY_USER_SYSPM_BAD_PARAM;
+    uint32_t wait_us;
+    cy_stc_user_syspm_cm55_restart_t restart;
+
+    memcpy(&wait_us, &inputs_ns->input_values[0], sizeof(wait_us));
+
+    if ((outputs_ptr_cnt_ns >= 1U) && (outputs_ptr_ns[0].len == sizeof(restart)))
+    {
+        retVal = Cy_USER_SysCm55PowerOn(wait_us, &restart);
+
+        memcpy(outputs_ptr_ns[0].base, &restart, sizeof(restart));
+    }
+
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
+
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_user_syspm_srf_getcoreclock_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
+{
+    CY_UNUSED_PARAMETER(inputs_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    cy_rslt_t retVal = CY_USER_SYSPM_BAD_PARAM;
+    uint32_t hz;
+
+    if ((outputs_ptr_cnt_ns >= 1U) && (outputs_ptr_ns[0].len == sizeof(hz)))
+    {
+        retVal = Cy_USER_SysGetCoreClock(&hz);
+
+        memcpy(outputs_ptr_ns[0].base, &hz, sizeof(hz));
+    }
+
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
+
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_user_syspm_srf_getresidency_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
+{
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    cy_rslt_t retVal = CY_USER_SYSPM_BAD_PARAM;
+    uint32_t clear;
+    cy_stc_user_syspm_residency_t residency;
+
+    memcpy(&clear, &inputs_ns->input_values[0], sizeof(clear));
+
+    if ((outputs_ptr_cnt_ns >= 1U) && (outputs_ptr_ns[0].len == sizeof(residency)))
+    {
+        retVal = Cy_USER_SysGetResidency(&residency, (0UL != clear));
+
+        memcpy(outputs_ptr_ns[0].base, &residency, sizeof(residency));
+    }
+
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
+
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_user_syspm_srf_settelemetrypage_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
+{
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_ns);
+    CY_UNUSED_PARAMETER(outputs_ptr_cnt_ns);
+    cy_rslt_t retVal;
+    uint32_t page;
+
+    memcpy(&page, &inputs_ns->input_values[0], sizeof(page));
+
+    retVal = Cy_USER_SysSetTelemetryPage((cy_stc_user_syspm_telemetry_page_t*)page);
+
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
+
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cy_user_syspm_srf_getstate_impl_s(mtb_srf_input_ns_t* inputs_ns,
+                                            mtb_srf_output_ns_t* outputs_ns,
+                                            mtb_srf_invec_ns_t* inputs_ptr_ns,
+                                            uint8_t inputs_ptr_cnt_ns,
+                                            mtb_srf_outvec_ns_t* outputs_ptr_ns,
+                                            uint8_t outputs_ptr_cnt_ns)
+{
+    CY_UNUSED_PARAMETER(inputs_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_ns);
+    CY_UNUSED_PARAMETER(inputs_ptr_cnt_ns);
+    cy_rslt_t retVal = CY_USER_SYSPM_BAD_PARAM;
+    cy_stc_user_syspm_state_t state;
+
+    if ((outputs_ptr_cnt_ns >= 1U) && (outputs_ptr_ns[0].len == sizeof(state)))
+    {
+        retVal = Cy_USER_SysGetState(&state);
+
+        memcpy(outputs_ptr_ns[0].base, &state, sizeof(state));
+    }
+
+    memcpy(&outputs_ns->output_values[0], &retVal, sizeof(retVal));
+
+    return (cy_rslt_t)CY_RSLT_SUCCESS;
+}
+
+/* All operations for the SYSPM submodule of the USER module */
+mtb_srf_op_s_t _cy_user_syspm_srf_operations[] =
+{
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_ENTERHIGHPERFORMANCE,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_enterhighperformance_impl_s,
+        .input_values_len = 0UL,
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ 0UL, 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_ENTERLOWPOWER,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_enterlowpower_impl_s,
+        .input_values_len = 0UL,
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ 0UL, 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_ENTERULTRALOWPOWER,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_enterultralowpower_impl_s,
+        .input_values_len = 0UL,
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ 0UL, 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_ENTERDEEPSLEEP,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_enterdeepsleep_impl_s,
+        .input_values_len = 0UL,
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ 0UL, 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_ENTERDEEPSLEEPRAM,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_enterdeepsleepram_impl_s,
+        .input_values_len = sizeof(cy_stc_user_syspm_ds_cfg_t),
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ 0UL, 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_ENTERDEEPSLEEPOFF,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_enterdeepsleepoff_impl_s,
+        .input_values_len = sizeof(cy_stc_user_syspm_ds_cfg_t),
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ 0UL, 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_ENTERHIBERNATE,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_enterhibernate_impl_s,
+        .input_values_len = sizeof(cy_stc_user_syspm_ds_cfg_t),
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ 0UL, 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_SETBACKUP,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_setbackup_impl_s,
+        .input_values_len = sizeof(cy_stc_user_syspm_backup_t),
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ 0UL, 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_GETBACKUP,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_getbackup_impl_s,
+        .input_values_len = 0UL,
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ sizeof(cy_stc_user_syspm_backup_t), 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_SETDEEPSLEEPMODES,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_setdeepsleepmodes_impl_s,
+        .input_values_len = sizeof(cy_stc_user_syspm_ds_modes_t),
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ sizeof(cy_stc_user_syspm_ds_latency_t), 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_SETSRAMPOWER,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_setsrampower_impl_s,
+        .input_values_len = sizeof(cy_stc_user_syspm_sram_cfg_t),
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ sizeof(uint32_t), 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_CM55POWEROFF,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_cm55poweroff_impl_s,
+        .input_values_len = 0UL,
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ 0UL, 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_CM55POWERON,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_cm55poweron_impl_s,
+        .input_values_len = sizeof(uint32_t),
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ sizeof(cy_stc_user_syspm_cm55_restart_t), 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_GETCORECLOCK,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_getcoreclock_impl_s,
+        .input_values_len = 0UL,
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ sizeof(uint32_t), 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_GETRESIDENCY,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_getresidency_impl_s,
+        .input_values_len = sizeof(uint32_t),
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ sizeof(cy_stc_user_syspm_residency_t), 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_SETTELEMETRYPAGE,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_settelemetrypage_impl_s,
+        .input_values_len = sizeof(uint32_t),
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ 0UL, 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    },
+    {
+        .module_id = MTB_SRF_MODULE_USER,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .op_id = CY_USER_SYSPM_OP_GETSTATE,
+        .write_required = false,
+        .impl = cy_user_syspm_srf_getstate_impl_s,
+        .input_values_len = 0UL,
+        .output_values_len = 0UL,
+        .input_len ={ 0UL, 0UL, 0UL },
+        .needs_copy = { false, false, false },
+        .output_len ={ sizeof(cy_stc_user_syspm_state_t), 0UL, 0UL },
+        .allowed_rsc = NULL,
+        .num_allowed = 0UL,
+    }
+};
+
+
+#else
+
+void _Cy_USER_SysPm_Invoke_SRF(cy_user_syspm_srf_op_id_t op_id, const void* input, size_t input_len,
+                               void* output, size_t output_len, cy_en_user_syspm_status_t* retval)
+{
+    cy_rslt_t result;
+
+    mtb_srf_invec_ns_t* inVec = NULL;
+    mtb_srf_outvec_ns_t* outVec = NULL;
+    mtb_srf_output_ns_t* output_ns = NULL;
+
+    /* Operation specific output structures are returned through outVec[1] */
+    void* outvec_bases[MTB_SRF_MAX_IOVEC - 2] = { output, NULL };
+    size_t outvec_sizes[MTB_SRF_MAX_IOVEC - 2] = { output_len, 0UL };
+
+    TRACE_BEGIN(TRACE_EV_SRF_CALL, op_id);
+
+    result = cy_user_srf_pool_allocate(&inVec, &outVec);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        *retval = CY_USER_SYSPM_FAIL;
+        TRACE_END(TRACE_EV_SRF_CALL, op_id);
+        return;
+    }
+
+    cy_user_invoke_srf_args invoke_args =
+    {
+        .inVec = inVec,
+        .outVec = outVec,
+        .output_ptr = &output_ns,
+        .op_id = op_id,
+        .submodule_id = CY_USER_SECURE_SUBMODULE_SYSPM,
+        .base = NULL,
+        .sub_block = 0UL,
+        .input_base = (uint8_t*)input,
+        .input_len = input_len,
+        .output_base = (uint8_t*)retval,
+        .output_len = sizeof(*retval),
+        .invec_bases = NULL,
+        .invec_sizes = 0UL,
+        .outvec_bases = (NULL != output) ? outvec_bases : NULL,
+        .outvec_sizes = (NULL != output) ? outvec_sizes : NULL
+    };
+
+    result = Cy_USER_Invoke_SRF(&invoke_args);
+
+    /* The entry can be taken by another request once freed, so the status is
+     * read first */
+    if ((CY_RSLT_SUCCESS == result) && (NULL != output_ns))
+    {
+        memcpy(retval, &(output_ns->output_values[0]), sizeof(*retval));
+    }
+    else
+    {
+        *retval = CY_USER_SYSPM_FAIL;
+    }
+
+    result = cy_user_srf_pool_free(inVec, outVec);
+    CY_ASSERT_L2(result == CY_RSLT_SUCCESS);
+    CY_UNUSED_PARAMETER(result);
+
+    TRACE_END(TRACE_EV_SRF_CALL, op_id);
+}
+
+/* Runs the non-secure SysPm callbacks registered for a mode the secure side
+ * enters on our behalf. Returns false if any callback is not ready. */
+static bool _Cy_USER_SysPm_PrepareCallbacks(cy_en_syspm_callback_type_t type)
+{
+    bool ready = (CY_SYSPM_SUCCESS == Cy_SysPm_ExecuteCallback(type, CY_SYSPM_CHECK_READY));
+
+    if (ready)
+    {
+        (void)Cy_SysPm_ExecuteCallback(type, CY_SYSPM_BEFORE_TRANSITION);
+    }
+    else
+    {
+        (void)Cy_SysPm_ExecuteCallback(type, CY_SYSPM_CHECK_FAIL);
+    }
+
+    return ready;
+}
+
+/* Telemetry page written by the secure side, read without secure requests */
+CY_SECTION_SHAREDMEM static cy_stc_user_syspm_telemetry_page_t user_syspm_telemetry_page;
+static bool user_syspm_telemetry_on = false;
+
+/* A read is only repeated when a whole update ran in between, so a few
+ * attempts are enough */
+#define TELEMETRY_READ_ATTEMPTS       (4U)
+
+/* Brings the non-secure clock bookkeeping in line with the CM33 clock after a
+ * power mode transition: SystemCoreClock, the Cy_SysLib_Delay calibration and,
+ * if SysTick runs from the CPU clock, its reload so that the tick rate holds. */
+static void _Cy_USER_SysPm_SyncCoreClock(void)
+{
+    uint32_t hz;
+    uint32_t old_hz = SystemCoreClock;
+    cy_stc_user_syspm_telemetry_t telemetry;
+
+    /** The telemetry page is updated by the transition, which saves a request */
+    if (Cy_USER_SysReadTelemetry(&telemetry))
+    {
+        hz = telemetry.core_hz;
+    }
+    else if (CY_USER_SYSPM_SUCCESS != Cy_USER_SysGetCoreClock(&hz))
+    {
+        return;
+    }
+
+    if ((0UL == hz) || (hz == old_hz))
+    {
+        return;
+    }
+
+    SystemCoreClock = hz;
+    cy_delayFreqHz = hz;
+    cy_delayFreqKhz = CY_SYSLIB_DIV_ROUNDUP(hz, 1000UL);
+    cy_delayFreqMhz = (uint8_t)CY_SYSLIB_DIV_ROUNDUP(hz, 1000000UL);
+
+    if ((0UL != (SysTick->CTRL & SysTick_CTRL_ENABLE_Msk)) &&
+        (0UL != (SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk)) && (0UL != old_hz))
+    {
+        uint64_t reload = (((uint64_t)SysTick->LOAD + 1ULL) * hz) / old_hz;
+
+        SysTick->LOAD = (reload > (uint64_t)SysTick_LOAD_RELOAD_Msk) ? SysTick_LOAD_RELOAD_Msk :
+                        (uint32_t)(reload - 1ULL);
+        SysTick->VAL = 0UL;
+    }
+}
+
+/* Transition notifiers, in registration order */
+static cy_stc_user_syspm_notifier_t* user_syspm_notifiers = NULL;
+
+/* System power mode, the device boots in HP mode */
+static cy_en_user_syspm_mode_t user_syspm_mode = CY_USER_SYSPM_MODE_HP;
+
+/* Calls a notifier handler and accounts the time spent in it. The cycles are
+ * converted with SystemCoreClock, which matches the clock of the call. */
+static cy_en_user_syspm_status_t _Cy_USER_SysPm_Notify(cy_stc_user_syspm_notifier_t* notifier,
+                                                       cy_en_user_syspm_notify_event_t event,
+                                                       const cy_stc_user_syspm_transition_t* transition)
+{
+    cy_en_user_syspm_status_t status;
+    uint32_t start;
+    uint32_t us;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    start = DWT->CYCCNT;
+
+    status = notifier->handler(event, transition, notifier->arg);
+
+    us = (DWT->CYCCNT - start) / CY_SYSLIB_DIV_ROUNDUP(SystemCoreClock, 1000000UL);
+
+    notifier->calls++;
+    notifier->total_us += us;
+    if (us > notifier->max_us)
+    {
+        notifier->max_us = us;
+    }
+
+    return status;
+}
+
+/* Requests an HP, LP or ULP transition from the secure side, with the
+ * notifiers prepared before and committed or aborted after the request */
+static cy_en_user_syspm_status_t _Cy_USER_SysPm_Transition(cy_user_syspm_srf_op_id_t op_id,
+                                                           cy_en_user_syspm_mode_t mode)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_SUCCESS;
+    cy_stc_user_syspm_transition_t transition;
+    cy_stc_user_syspm_notifier_t* last = NULL;
+    cy_en_user_syspm_notify_event_t event;
+
+    /* Keeps the mode and the notifier list stable for the whole transition */
+    cy_user_srf_lock();
+
+    transition.from = user_syspm_mode;
+    transition.to = mode;
+
+    TRACE_BEGIN(TRACE_EV_PM_TRANSITION, mode);
+
+    /* Requesting the current mode again changes nothing the notifiers see */
+    if (transition.from != transition.to)
+    {
+        TRACE_BEGIN(TRACE_EV_PM_PREPARE, mode);
+
+        for (cy_stc_user_syspm_notifier_t* notifier = user_syspm_notifiers;
+             (NULL != notifier) && (CY_USER_SYSPM_SUCCESS == result); notifier = notifier->next)
+        {
+            result = _Cy_USER_SysPm_Notify(notifier, CY_USER_SYSPM_NOTIFY_PREPARE, &transition);
+            last = notifier;
+        }
+
+        TRACE_END(TRACE_EV_PM_PREPARE, mode);
+    }
+
+    if (CY_USER_SYSPM_SUCCESS == result)
+    {
+        _Cy_USER_SysPm_Invoke_SRF(op_id, NULL, 0UL, NULL, 0UL, &result);
+    }
+
+    if (CY_USER_SYSPM_SUCCESS == result)
+    {
+        user_syspm_mode = mode;
+        _Cy_USER_SysPm_SyncCoreClock();
+        event = CY_USER_SYSPM_NOTIFY_COMMIT;
+    }
+    else
+    {
+        event = CY_USER_SYSPM_NOTIFY_ABORT;
+    }
+
+    TRACE_BEGIN(TRACE_EV_PM_COMMIT, mode);
+
+    for (cy_stc_user_syspm_notifier_t* notifier = last; NULL != notifier; notifier = notifier->prev)
+    {
+        (void)_Cy_USER_SysPm_Notify(notifier, event, &transition);
+    }
+
+    TRACE_END(TRACE_EV_PM_COMMIT, mode);
+    TRACE_END(TRACE_EV_PM_TRANSITION, mode);
+
+    cy_user_srf_unlock();
+
+    return result;
+}
+
+#endif /* defined(COMPONENT_SECURE_DEVICE) */
+
+cy_en_user_syspm_status_t Cy_USER_SysEnterHp(void)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    cy_en_syspm_status_t status;
+
+    TRACE_BEGIN(TRACE_EV_PM_SWITCH, CY_USER_SYSPM_MODE_HP);
+
+    status = Cy_SysPm_SystemEnterHp();
+    if ((CY_SYSPM_SUCCESS == status) && Cy_SysPm_IsSystemHp())
+    {
+        /** Set the high-frequency clock (CLKHF) divide */
+        Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0, CY_SYSCLK_CLKHF_DIVIDE_BY_2);
+
+        /** Adjust the peripheral clock divider for the debug UART */
+        Cy_SysClk_PeriPclkSetDivider((en_clk_dst_t)CYBSP_DEBUG_UART_CLK_DIV_GRP_NUM,
+                                     CY_SYSCLK_DIV_16_BIT, 1U, UART_HP_DIV);
+
+        _Cy_USER_SysPm_ResidencySwitch((uint32_t)CY_USER_SYSPM_MODE_HP, true);
+
+        user_syspm_tlm_transitions++;
+        _Cy_USER_SysPm_PublishTelemetry();
+
+        result = CY_USER_SYSPM_SUCCESS;
+    }
+    else
+    {
+        user_syspm_res_failures++;
+    }
+
+    TRACE_END(TRACE_EV_PM_SWITCH, CY_USER_SYSPM_MODE_HP);
+
+#else
+
+    result = _Cy_USER_SysPm_Transition(CY_USER_SYSPM_OP_ENTERHIGHPERFORMANCE, CY_USER_SYSPM_MODE_HP);
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysEnterLp(void)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    cy_en_syspm_status_t status;
+
+    TRACE_BEGIN(TRACE_EV_PM_SWITCH, CY_USER_SYSPM_MODE_LP);
+
+    status = Cy_SysPm_SystemEnterLp();
+    if ((CY_SYSPM_SUCCESS == status) && Cy_SysPm_IsSystemLp())
+    {
+        /** Set the high-frequency clock (CLKHF) divide */
+        Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0, CY_SYSCLK_CLKHF_DIVIDE_BY_2);
+
+        /** Adjust the peripheral clock divider for the debug UART */
+        Cy_SysClk_PeriPclkSetDivider((en_clk_dst_t)CYBSP_DEBUG_UART_CLK_DIV_GRP_NUM,
+                                     CY_SYSCLK_DIV_16_BIT, 1U, UART_LP_DIV);
+
+        _Cy_USER_SysPm_ResidencySwitch((uint32_t)CY_USER_SYSPM_MODE_LP, true);
+
+        user_syspm_tlm_transitions++;
+        _Cy_USER_SysPm_PublishTelemetry();
+
+        result = CY_USER_SYSPM_SUCCESS;
+    }
+    else
+    {
+        user_syspm_res_failures++;
+    }
+
+    TRACE_END(TRACE_EV_PM_SWITCH, CY_USER_SYSPM_MODE_LP);
+
+#else
+
+    result = _Cy_USER_SysPm_Transition(CY_USER_SYSPM_OP_ENTERLOWPOWER, CY_USER_SYSPM_MODE_LP);
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysEnterUlp(void)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    cy_en_syspm_status_t status;
+
+    TRACE_BEGIN(TRACE_EV_PM_SWITCH, CY_USER_SYSPM_MODE_ULP);
+
+    status = Cy_SysPm_SystemEnterUlp();
+    if ((CY_SYSPM_SUCCESS == status) && Cy_SysPm_IsSystemUlp())
+    {
+
+        /** Set the high-frequency clock (CLKHF) to no divide */
+        Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0, CY_SYSCLK_CLKHF_NO_DIVIDE);
+
+        /** Adjust the peripheral clock divider for the debug UART */
+        Cy_SysClk_PeriPclkSetDivider((en_clk_dst_t)CYBSP_DEBUG_UART_CLK_DIV_GRP_NUM,
+                                     CY_SYSCLK_DIV_16_BIT, 1U, UART_ULP_DIV);
+
+        _Cy_USER_SysPm_ResidencySwitch((uint32_t)CY_USER_SYSPM_MODE_ULP, true);
+
+        user_syspm_tlm_transitions++;
+        _Cy_USER_SysPm_PublishTelemetry();
+
+        result = CY_USER_SYSPM_SUCCESS;
+    }
+    else
+    {
+        user_syspm_res_failures++;
+    }
+
+    TRACE_END(TRACE_EV_PM_SWITCH, CY_USER_SYSPM_MODE_ULP);
+
+#else
+
+    result = _Cy_USER_SysPm_Transition(CY_USER_SYSPM_OP_ENTERULTRALOWPOWER, CY_USER_SYSPM_MODE_ULP);
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysEnterDS(void)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    cy_en_syspm_status_t status;
+
+    if (user_syspm_sram_ds_mask != user_syspm_sram_active_mask)
+    {
+        _Cy_USER_SysPm_SetSramMacros(user_syspm_sram_ds_mask);
+    }
+
+    _Cy_USER_SysPm_SeDisable();
+
+    _Cy_USER_SysPm_ResidencySwitch(CY_USER_SYSPM_RESIDENCY_DS, true);
+    TRACE_BEGIN(TRACE_EV_DEEP_SLEEP, 0UL);
+
+    status = Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+
+    TRACE_END(TRACE_EV_DEEP_SLEEP, 0UL);
+    _Cy_USER_SysPm_ResidencySwitch(user_syspm_res_active, false);
+
+    if (CY_SYSPM_SUCCESS == status)
+    {
+        _Cy_USER_SysPm_SeEnable();
+
+        user_syspm_tlm_ds_entries++;
+        _Cy_USER_SysPm_PublishTelemetry();
+
+        result = CY_USER_SYSPM_SUCCESS;
+    }
+    else
+    {
+        user_syspm_res_failures++;
+    }
+
+    if (user_syspm_sram_ds_mask != user_syspm_sram_active_mask)
+    {
+        _Cy_USER_SysPm_SetSramMacros(user_syspm_sram_active_mask);
+    }
+
+#else
+
+    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_ENTERDEEPSLEEP, NULL, 0UL, NULL, 0UL, &result);
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysEnterDSRam(const cy_stc_user_syspm_ds_cfg_t* config)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+    if (NULL == config)
+    {
+        return CY_USER_SYSPM_BAD_PARAM;
+    }
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    cy_en_syspm_status_t status;
+
+    status = Cy_SysPm_SetDeepSleepMode(CY_SYSPM_MODE_DEEPSLEEP_RAM);
+    if (CY_SYSPM_SUCCESS == status)
+    {
+        status = Cy_SysPm_SetSOCMEMDeepSleepMode((0UL != config->socmem_retain) ?
+                                                 CY_SYSPM_MODE_DEEPSLEEP : CY_SYSPM_MODE_DEEPSLEEP_OFF);
+    }
+
+    if (CY_SYSPM_SUCCESS == status)
+    {
+        /** Protected macros must survive the sleep regardless of the request */
+        _Cy_USER_SysPm_SetSramMacros((config->sram_retain_mask & user_syspm_sram_active_mask) |
+                                     _Cy_USER_SysPm_ProtectedSramMacros());
+
+        _Cy_USER_SysPm_SeDisable();
+
+        _Cy_USER_SysPm_ResidencySwitch(CY_USER_SYSPM_RESIDENCY_DS, true);
+        TRACE_BEGIN(TRACE_EV_DEEP_SLEEP, 1UL);
+
+        status = Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+
+        TRACE_END(TRACE_EV_DEEP_SLEEP, 1UL);
+        _Cy_USER_SysPm_ResidencySwitch(user_syspm_res_active, false);
+
+        _Cy_USER_SysPm_SeEnable();
+
+        /** Macros that were off come back empty, power them up for the application */
+        _Cy_USER_SysPm_SetSramMacros(user_syspm_sram_active_mask);
+
+        if (CY_SYSPM_SUCCESS == status)
+        {
+            user_syspm_tlm_ds_entries++;
+            _Cy_USER_SysPm_PublishTelemetry();
+
+            result = CY_USER_SYSPM_SUCCESS;
+        }
+        else
+        {
+            user_syspm_res_failures++;
+        }
+    }
+
+    /** Restore the Deep Sleep configuration used by Cy_USER_SysEnterDS */
+    (void)Cy_SysPm_SetDeepSleepMode((cy_en_syspm_deep_sleep_mode_t)user_syspm_ds_modes.sys_mode);
+    (void)Cy_SysPm_SetSOCMEMDeepSleepMode((cy_en_syspm_deep_sleep_mode_t)user_syspm_ds_modes.socmem_mode);
+
+#else
+
+    if (_Cy_USER_SysPm_PrepareCallbacks(CY_SYSPM_DEEPSLEEP_RAM))
+    {
+        _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_ENTERDEEPSLEEPRAM, config, sizeof(*config), NULL, 0UL, &result);
+
+        (void)Cy_SysPm_ExecuteCallback(CY_SYSPM_DEEPSLEEP_RAM, CY_SYSPM_AFTER_TRANSITION);
+    }
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysEnterDSOff(const cy_stc_user_syspm_ds_cfg_t* config)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+    if (NULL == config)
+    {
+        return CY_USER_SYSPM_BAD_PARAM;
+    }
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    cy_en_syspm_status_t status;
+
+    if (!_Cy_USER_SysPm_IsValidWakeupSrc(config->wakeup_src))
+    {
+        return CY_USER_SYSPM_BAD_PARAM;
+    }
+
+    Cy_SysPm_SetHibernateWakeupSource(config->wakeup_src);
+
+    status = Cy_SysPm_SetDeepSleepMode(CY_SYSPM_MODE_DEEPSLEEP_OFF);
+    if (CY_SYSPM_SUCCESS == status)
+    {
+        _Cy_USER_SysPm_SeDisable();
+
+        /** Wake-up from DS-OFF goes through reset, returning here means the
+         * entry was aborted by a pending interrupt */
+        (void)Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+
+        _Cy_USER_SysPm_SeEnable();
+    }
+
+    (void)Cy_SysPm_SetDeepSleepMode((cy_en_syspm_deep_sleep_mode_t)user_syspm_ds_modes.sys_mode);
+    Cy_SysPm_ClearHibernateWakeupSource(config->wakeup_src);
+
+#else
+
+    if (_Cy_USER_SysPm_PrepareCallbacks(CY_SYSPM_DEEPSLEEP_OFF))
+    {
+        _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_ENTERDEEPSLEEPOFF, config, sizeof(*config), NULL, 0UL, &result);
+
+        (void)Cy_SysPm_ExecuteCallback(CY_SYSPM_DEEPSLEEP_OFF, CY_SYSPM_AFTER_TRANSITION);
+    }
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysEnterHibernate(const cy_stc_user_syspm_ds_cfg_t* config)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+    if (NULL == config)
+    {
+        return CY_USER_SYSPM_BAD_PARAM;
+    }
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    if (!_Cy_USER_SysPm_IsValidWakeupSrc(config->wakeup_src))
+    {
+        return CY_USER_SYSPM_BAD_PARAM;
+    }
+
+    Cy_SysPm_SetHibernateWakeupSource(config->wakeup_src);
+
+    _Cy_USER_SysPm_SeDisable();
+
+    /** Wake-up from Hibernate goes through reset */
+    (void)Cy_SysPm_SystemEnterHibernate();
+
+    _Cy_USER_SysPm_SeEnable();
+
+    Cy_SysPm_ClearHibernateWakeupSource(config->wakeup_src);
+
+#else
+
+    if (_Cy_USER_SysPm_PrepareCallbacks(CY_SYSPM_HIBERNATE))
+    {
+        _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_ENTERHIBERNATE, config, sizeof(*config), NULL, 0UL, &result);
+
+        (void)Cy_SysPm_ExecuteCallback(CY_SYSPM_HIBERNATE, CY_SYSPM_AFTER_TRANSITION);
+    }
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysSetBackup(const cy_stc_user_syspm_backup_t* backup)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+    if (NULL == backup)
+    {
+        return CY_USER_SYSPM_BAD_PARAM;
+    }
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    for (uint32_t i = 0U; i < CY_USER_SYSPM_BACKUP_WORDS; i++)
+    {
+        USER_SYSPM_BACKUP_REG[i] = backup->words[i];
+    }
+
+    result = CY_USER_SYSPM_SUCCESS;
+
+#else
+
+    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_SETBACKUP, backup, sizeof(*backup), NULL, 0UL, &result);
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysGetBackup(cy_stc_user_syspm_backup_t* backup)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+    if (NULL == backup)
+    {
+        return CY_USER_SYSPM_BAD_PARAM;
+    }
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    for (uint32_t i = 0U; i < CY_USER_SYSPM_BACKUP_WORDS; i++)
+    {
+        backup->words[i] = USER_SYSPM_BACKUP_REG[i];
+    }
+
+    result = CY_USER_SYSPM_SUCCESS;
+
+#else
+
+    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_GETBACKUP, NULL, 0UL, backup, sizeof(*backup), &result);
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysSetDeepSleepModes(const cy_stc_user_syspm_ds_modes_t* modes,
+                                                       cy_stc_user_syspm_ds_latency_t* latency)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+    if (NULL == modes)
+    {
+        return CY_USER_SYSPM_BAD_PARAM;
+    }
+
+#if defined(COMPONENT_SECURE_DEVICE)
 
     cy_en_syspm_status_t status;
 
-    status = Cy_SysPm_SystemEnterLp();
-    if ((CY_SYSPM_SUCCESS == status) && Cy_SysPm_IsSystemLp())
+    if (_Cy_USER_SysPm_IsValidDsMode(modes->sys_mode) &&
+        _Cy_USER_SysPm_IsValidDsMode(modes->app_mode) &&
+        _Cy_USER_SysPm_IsValidDsMode(modes->socmem_mode))
     {
-        /** Set the high-frequency clock (CLKHF) divide */
-        Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0, CY_SYSCLK_CLKHF_DIVIDE_BY_2);
+        status = Cy_SysPm_SetDeepSleepMode((cy_en_syspm_deep_sleep_mode_t)modes->sys_mode);
+        if (CY_SYSPM_SUCCESS == status)
+        {
+            status = Cy_SysPm_SetAppDeepSleepMode(_Cy_USER_SysPm_AppDsMode(modes->app_mode));
+        }
+        if (CY_SYSPM_SUCCESS == status)
+        {
+            status = Cy_SysPm_SetSOCMEMDeepSleepMode((cy_en_syspm_deep_sleep_mode_t)modes->socmem_mode);
+        }
+
+        if (CY_SYSPM_SUCCESS == status)
+        {
+            user_syspm_ds_modes = *modes;
+            result = CY_USER_SYSPM_SUCCESS;
+        }
+        else
+        {
+            /** Keep the domains consistent with the last accepted configuration */
+            (void)Cy_SysPm_SetDeepSleepMode((cy_en_syspm_deep_sleep_mode_t)user_syspm_ds_modes.sys_mode);
+            (void)Cy_SysPm_SetAppDeepSleepMode(_Cy_USER_SysPm_AppDsMode(user_syspm_ds_modes.app_mode));
+            (void)Cy_SysPm_SetSOCMEMDeepSleepMode((cy_en_syspm_deep_sleep_mode_t)user_syspm_ds_modes.socmem_mode);
+        }
+    }
+    else
+    {
+        result = CY_USER_SYSPM_BAD_PARAM;
+    }
 
-        /** Adjust the peripheral clock divider for the debug UART */
-        Cy_SysClk_PeriPclkSetDivider((en_clk_dst_t)CYBSP_DEBUG_UART_CLK_DIV_GRP_NUM,
-                                     CY_SYSCLK_DIV_16_BIT, 1U, UART_LP_DIV);
+    if (NULL != latency)
+    {
+        latency->sys_wakeup_us = _Cy_USER_SysPm_DsWakeupUs(user_syspm_ds_modes.sys_mode);
+        latency->app_wakeup_us = _Cy_USER_SysPm_DsWakeupUs(user_syspm_ds_modes.app_mode);
+        latency->socmem_wakeup_us = ((uint32_t)CY_SYSPM_MODE_DEEPSLEEP_OFF == user_syspm_ds_modes.socmem_mode) ?
+                                    SOCMEM_OFF_WAKEUP_US : SOCMEM_RETAINED_WAKEUP_US;
+    }
+
+#else
+
+    cy_stc_user_syspm_ds_latency_t latency_ns = { 0UL, 0UL, 0UL };
+
+    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_SETDEEPSLEEPMODES, modes, sizeof(*modes),
+                              &latency_ns, sizeof(latency_ns), &result);
+
+    if (NULL != latency)
+    {
+        *latency = latency_ns;
+    }
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysSetSramPower(const cy_stc_user_syspm_sram_cfg_t* config,
+                                                  uint32_t* protected_mask)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+    if (NULL == config)
+    {
+        return CY_USER_SYSPM_BAD_PARAM;
+    }
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    uint32_t protected_macros = _Cy_USER_SysPm_ProtectedSramMacros();
+
+    if ((0UL != (config->active_mask & ~CY_USER_SYSPM_SRAM_ALL_MACROS)) ||
+        (0UL != (config->ds_retain_mask & ~config->active_mask)) ||
+        ((config->ds_retain_mask & protected_macros) != protected_macros))
+    {
+        result = CY_USER_SYSPM_BAD_PARAM;
+    }
+    else
+    {
+        user_syspm_sram_active_mask = config->active_mask;
+        user_syspm_sram_ds_mask = config->ds_retain_mask;
+
+        _Cy_USER_SysPm_SetSramMacros(user_syspm_sram_active_mask);
 
         result = CY_USER_SYSPM_SUCCESS;
     }
 
+    if (NULL != protected_mask)
+    {
+        *protected_mask = protected_macros;
+    }
+
 #else
 
-    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_ENTERLOWPOWER, &result);
+    uint32_t protected_ns = 0UL;
+
+    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_SETSRAMPOWER, config, sizeof(*config),
+                              &protected_ns, sizeof(protected_ns), &result);
+
+    if (NULL != protected_mask)
+    {
+        *protected_mask = protected_ns;
+    }
 
 #endif /* defined(COMPONENT_SECURE_DEVICE)*/
 
     return result;
 }
 
-cy_en_user_syspm_status_t Cy_USER_SysEnterUlp(void)
+cy_en_user_syspm_status_t Cy_USER_SysCm55PowerOff(void)
 {
     cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
 
 #if defined(COMPONENT_SECURE_DEVICE)
 
-    cy_en_syspm_status_t status;
+    if (user_syspm_cm55_on)
+    {
+        Cy_SysDisableCM55(MXCM55);
+        user_syspm_cm55_on = false;
+    }
 
-    status = Cy_SysPm_SystemEnterUlp();
-    if ((CY_SYSPM_SUCCESS == status) && Cy_SysPm_IsSystemUlp())
+    /** Without the CM55 as a requestor, the domain drops into its Deep Sleep depth */
+    if (CY_SYSPM_SUCCESS == Cy_SysPm_SetAppDeepSleepMode(_Cy_USER_SysPm_AppDsMode(user_syspm_ds_modes.app_mode)))
     {
+        result = CY_USER_SYSPM_SUCCESS;
+    }
 
-        /** Set the high-frequency clock (CLKHF) to no divide */
-        Cy_SysClk_ClkHfSetDivider(CY_CFG_SYSCLK_CLKHF0, CY_SYSCLK_CLKHF_NO_DIVIDE);
+#else
 
-        /** Adjust the peripheral clock divider for the debug UART */
-        Cy_SysClk_PeriPclkSetDivider((en_clk_dst_t)CYBSP_DEBUG_UART_CLK_DIV_GRP_NUM,
-                                     CY_SYSCLK_DIV_16_BIT, 1U, UART_ULP_DIV);
+    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_CM55POWEROFF, NULL, 0UL, NULL, 0UL, &result);
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysCm55PowerOn(uint32_t wait_us, cy_stc_user_syspm_cm55_restart_t* restart)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+#if defined(COMPONENT_SECURE_DEVICE)
 
+    uint32_t start;
+    uint32_t cycles = 0UL;
+    bool validated = false;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    start = DWT->CYCCNT;
+
+    if (user_syspm_cm55_on)
+    {
         result = CY_USER_SYSPM_SUCCESS;
     }
+    else
+    {
+        if (!user_syspm_cm55_validated)
+        {
+            user_syspm_cm55_image_ok = _Cy_USER_SysPm_Cm55ImageValid();
+            user_syspm_cm55_validated = true;
+            validated = true;
+        }
+
+        if (user_syspm_cm55_image_ok)
+        {
+            user_syspm_cm55_on = true;
+            (void)Cy_SysPm_SetAppDeepSleepMode(_Cy_USER_SysPm_AppDsMode(user_syspm_ds_modes.app_mode));
+
+            Cy_SysEnableCM55(MXCM55, CM55_APP_BOOT_ADDR, wait_us);
+
+            cycles = DWT->CYCCNT - start;
+            result = CY_USER_SYSPM_SUCCESS;
+        }
+    }
+
+    if (NULL != restart)
+    {
+        /** The clock may have been changed by a power mode transition */
+        SystemCoreClockUpdate();
+
+        restart->restart_us = cycles / (SystemCoreClock / 1000000UL);
+        restart->validated = validated ? 1UL : 0UL;
+    }
+
+#else
+
+    cy_stc_user_syspm_cm55_restart_t restart_ns = { 0UL, 0UL };
+
+    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_CM55POWERON, &wait_us, sizeof(wait_us),
+                              &restart_ns, sizeof(restart_ns), &result);
+
+    if (NULL != restart)
+    {
+        *restart = restart_ns;
+    }
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysGetCoreClock(uint32_t* hz)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    SystemCoreClockUpdate();
+    *hz = SystemCoreClock;
+
+    result = CY_USER_SYSPM_SUCCESS;
 
 #else
 
-    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_ENTERULTRALOWPOWER, &result);
+    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_GETCORECLOCK, NULL, 0UL, hz, sizeof(*hz), &result);
 
 #endif /* defined(COMPONENT_SECURE_DEVICE)*/
 
     return result;
 }
 
-cy_en_user_syspm_status_t Cy_USER_SysEnterDS(void)
+cy_en_user_syspm_status_t Cy_USER_SysGetResidency(cy_stc_user_syspm_residency_t* residency, bool clear)
 {
     cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
 
 #if defined(COMPONENT_SECURE_DEVICE)
 
-    cy_en_syspm_status_t status;
+    uint64_t charge = 0ULL;
 
-    ifx_se_disable(NULL);
+    /** Bring the current state up to date */
+    _Cy_USER_SysPm_ResidencySwitch(user_syspm_res_state, false);
 
-    status = Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
-    if (CY_SYSPM_SUCCESS == status)
+    if (NULL != residency)
+    {
+        for (uint32_t state = 0U; state < CY_USER_SYSPM_RESIDENCY_STATES; state++)
+        {
+            residency->residency_us[state] = (user_syspm_res_ticks[state] * 1000000ULL) / RESIDENCY_TIMER_HZ;
+            residency->entries[state] = user_syspm_res_entries[state];
+            residency->current_ua[state] = user_syspm_res_current_ua[state];
+
+            /** uA * ticks / Hz gives uC */
+            charge += user_syspm_res_ticks[state] * user_syspm_res_current_ua[state];
+        }
+
+        residency->charge_uc = charge / RESIDENCY_TIMER_HZ;
+        residency->failures = user_syspm_res_failures;
+        residency->discarded = user_syspm_res_discarded;
+    }
+
+    if (clear)
+    {
+        memset(user_syspm_res_ticks, 0, sizeof(user_syspm_res_ticks));
+        memset(user_syspm_res_entries, 0, sizeof(user_syspm_res_entries));
+        user_syspm_res_failures = 0UL;
+        user_syspm_res_discarded = 0UL;
+    }
+
+    result = CY_USER_SYSPM_SUCCESS;
+
+#else
+
+    uint32_t clear_ns = clear ? 1UL : 0UL;
+    cy_stc_user_syspm_residency_t residency_ns;
+
+    memset(&residency_ns, 0, sizeof(residency_ns));
+
+    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_GETRESIDENCY, &clear_ns, sizeof(clear_ns),
+                              &residency_ns, sizeof(residency_ns), &result);
+
+    if (NULL != residency)
+    {
+        *residency = residency_ns;
+    }
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysSetTelemetryPage(cy_stc_user_syspm_telemetry_page_t* page)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_BAD_PARAM;
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    if (NULL == page)
+    {
+        user_syspm_telemetry = NULL;
+        result = CY_USER_SYSPM_SUCCESS;
+    }
+    /** The page must be aligned and writable by the non-secure side */
+    else if ((0UL == ((uint32_t)page & (sizeof(uint32_t) - 1UL))) &&
+             (NULL != cmse_check_address_range(page, sizeof(*page), CMSE_NONSECURE | CMSE_MPU_READWRITE)))
     {
-        ifx_se_enable(NULL);
+        user_syspm_telemetry = page;
+
+        user_syspm_telemetry->magic = 0UL;
+        user_syspm_telemetry->seq = 0UL;
+        user_syspm_telemetry->version = CY_USER_SYSPM_TELEMETRY_VERSION;
+        user_syspm_telemetry->size = sizeof(cy_stc_user_syspm_telemetry_t);
+        _Cy_USER_SysPm_PublishTelemetry();
+        __DMB();
+        user_syspm_telemetry->magic = CY_USER_SYSPM_TELEMETRY_MAGIC;
 
         result = CY_USER_SYSPM_SUCCESS;
     }
 
 #else
 
-    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_ENTERDEEPSLEEP, &result);
+    uint32_t page_ns = (uint32_t)page;
+
+    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_SETTELEMETRYPAGE, &page_ns, sizeof(page_ns), NULL, 0UL, &result);
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysGetState(cy_stc_user_syspm_state_t* state)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_FAIL;
+
+    if (NULL == state)
+    {
+        return CY_USER_SYSPM_BAD_PARAM;
+    }
+
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    SystemCoreClockUpdate();
+
+    state->mode = (uint32_t)Cy_USER_SysGetPowerMode();
+    state->core_hz = SystemCoreClock;
+    state->clkhf0_div = (uint32_t)Cy_SysClk_ClkHfGetDivider(CY_CFG_SYSCLK_CLKHF0);
+    state->clkhf0_hz = Cy_SysClk_ClkHfGetFrequency(CY_CFG_SYSCLK_CLKHF0);
+    state->dpll_hz = Cy_SysClk_PllGetFrequency(SRSS_DPLL_LP_0_PATH_NUM);
+    state->rram_vmode = user_syspm_rram_vmode[state->mode];
+    state->ds_modes = user_syspm_ds_modes;
+    state->ds_modes.app_mode = (uint32_t)_Cy_USER_SysPm_AppDsMode(user_syspm_ds_modes.app_mode);
+    state->se_enabled = user_syspm_se_enabled ? 1UL : 0UL;
+
+    result = CY_USER_SYSPM_SUCCESS;
+
+#else
+
+    _Cy_USER_SysPm_Invoke_SRF(CY_USER_SYSPM_OP_GETSTATE, NULL, 0UL, state, sizeof(*state), &result);
+
+#endif /* defined(COMPONENT_SECURE_DEVICE)*/
+
+    return result;
+}
+
+cy_en_user_syspm_mode_t Cy_USER_SysGetPowerMode(void)
+{
+#if defined(COMPONENT_SECURE_DEVICE)
+
+    cy_en_user_syspm_mode_t mode = CY_USER_SYSPM_MODE_HP;
+
+    if (Cy_SysPm_IsSystemUlp())
+    {
+        mode = CY_USER_SYSPM_MODE_ULP;
+    }
+    else if (Cy_SysPm_IsSystemLp())
+    {
+        mode = CY_USER_SYSPM_MODE_LP;
+    }
+
+    return mode;
+
+#else
+
+    return user_syspm_mode;
 
 #endif /* defined(COMPONENT_SECURE_DEVICE)*/
+}
+
+#if !defined(COMPONENT_SECURE_DEVICE)
+cy_en_user_syspm_status_t Cy_USER_SysTelemetryInit(void)
+{
+    cy_en_user_syspm_status_t result;
+
+    memset(&user_syspm_telemetry_page, 0, sizeof(user_syspm_telemetry_page));
+
+    result = Cy_USER_SysSetTelemetryPage(&user_syspm_telemetry_page);
+
+    user_syspm_telemetry_on = ((CY_USER_SYSPM_SUCCESS == result) &&
+                               (CY_USER_SYSPM_TELEMETRY_MAGIC == user_syspm_telemetry_page.magic) &&
+                               (CY_USER_SYSPM_TELEMETRY_VERSION == user_syspm_telemetry_page.version));
+
+    return user_syspm_telemetry_on ? CY_USER_SYSPM_SUCCESS : CY_USER_SYSPM_FAIL;
+}
+
+bool Cy_USER_SysReadTelemetry(cy_stc_user_syspm_telemetry_t* telemetry)
+{
+    const volatile cy_stc_user_syspm_telemetry_page_t* page = &user_syspm_telemetry_page;
+    uint32_t seq;
+
+    if (!user_syspm_telemetry_on)
+    {
+        return false;
+    }
+
+    for (uint32_t attempt = 0U; attempt < TELEMETRY_READ_ATTEMPTS; attempt++)
+    {
+        seq = page->seq;
+        __DMB();
+        *telemetry = page->copy[seq & 1UL];
+        __DMB();
+
+        if (seq == page->seq)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysRegisterNotifier(cy_stc_user_syspm_notifier_t* notifier)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_BAD_PARAM;
+    cy_stc_user_syspm_notifier_t** tail = &user_syspm_notifiers;
+    cy_stc_user_syspm_notifier_t* prev = NULL;
+
+    cy_user_srf_lock();
+
+    if ((NULL != notifier) && (NULL != notifier->handler))
+    {
+        result = CY_USER_SYSPM_SUCCESS;
+
+        while ((NULL != *tail) && (CY_USER_SYSPM_SUCCESS == result))
+        {
+            if (*tail == notifier)
+            {
+                result = CY_USER_SYSPM_BAD_PARAM;
+            }
+
+            prev = *tail;
+            tail = &(*tail)->next;
+        }
+    }
+
+    if (CY_USER_SYSPM_SUCCESS == result)
+    {
+        notifier->next = NULL;
+        notifier->prev = prev;
+        *tail = notifier;
+    }
+
+    cy_user_srf_unlock();
+
+    return result;
+}
+
+cy_en_user_syspm_status_t Cy_USER_SysUnregisterNotifier(cy_stc_user_syspm_notifier_t* notifier)
+{
+    cy_en_user_syspm_status_t result = CY_USER_SYSPM_BAD_PARAM;
+
+    cy_user_srf_lock();
+
+    for (cy_stc_user_syspm_notifier_t* cur = user_syspm_notifiers; NULL != cur; cur = cur->next)
+    {
+        if (cur == notifier)
+        {
+            if (NULL != notifier->prev)
+            {
+                notifier->prev->next = notifier->next;
+            }
+            else
+            {
+                user_syspm_notifiers = notifier->next;
+            }
+
+            if (NULL != notifier->next)
+            {
+                notifier->next->prev = notifier->prev;
+            }
+
+            notifier->next = NULL;
+            notifier->prev = NULL;
+            result = CY_USER_SYSPM_SUCCESS;
+            break;
+        }
+    }
+
+    cy_user_srf_unlock();
 
     return result;
 }
+#endif /* !defined(COMPONENT_SECURE_DEVICE) */
@@ -35,6 +35,22 @@
 #define CY_USER_SYSPM_SRF_POOL_TIMEOUT       0UL
 #endif /* !defined(COMPONENT_SECURE_DEVICE) */
 
+/** Size of one SRAM macro that can be retained or powered off independently. */
+#define CY_USER_SYSPM_SRAM_MACRO_SIZE        (0x10000UL)
+
+/** Number of SRAM macros in each of SRAM0 and SRAM1. */
+#define CY_USER_SYSPM_SRAM_MACROS_PER_BANK   (8U)
+
+/** Mask covering every SRAM macro. Bit n is SRAM0 macro n for n < 8 and
+ * SRAM1 macro (n - 8) otherwise. */
+#define CY_USER_SYSPM_SRAM_ALL_MACROS        (0xFFFFUL)
+
+/** Non-secure alias of the SRAM base address. */
+#define CY_USER_SYSPM_SRAM_BASE_NS           (0x24000000UL)
+
+/** Address bit selecting the secure alias. */
+#define CY_USER_SYSPM_SECURE_ALIAS_MSK       (0x10000000UL)
+
 /** The USER SysPm function return value status definitions. */
 typedef enum
 {
@@ -50,9 +66,186 @@ typedef enum
     CY_USER_SYSPM_OP_ENTERLOWPOWER,         /**< Cy_USER_SysEnterLp */
     CY_USER_SYSPM_OP_ENTERULTRALOWPOWER,    /**< Cy_USER_SysEnterUlp */
     CY_USER_SYSPM_OP_ENTERDEEPSLEEP,        /**< Cy_USER_SysEnterDS */
+    CY_USER_SYSPM_OP_ENTERDEEPSLEEPRAM,     /**< Cy_USER_SysEnterDSRam */
+    CY_USER_SYSPM_OP_ENTERDEEPSLEEPOFF,     /**< Cy_USER_SysEnterDSOff */
+    CY_USER_SYSPM_OP_ENTERHIBERNATE,        /**< Cy_USER_SysEnterHibernate */
+    CY_USER_SYSPM_OP_SETBACKUP,             /**< Cy_USER_SysSetBackup */
+    CY_USER_SYSPM_OP_GETBACKUP,             /**< Cy_USER_SysGetBackup */
+    CY_USER_SYSPM_OP_SETDEEPSLEEPMODES,     /**< Cy_USER_SysSetDeepSleepModes */
+    CY_USER_SYSPM_OP_SETSRAMPOWER,          /**< Cy_USER_SysSetSramPower */
+    CY_USER_SYSPM_OP_CM55POWEROFF,          /**< Cy_USER_SysCm55PowerOff */
+    CY_USER_SYSPM_OP_CM55POWERON,           /**< Cy_USER_SysCm55PowerOn */
+    CY_USER_SYSPM_OP_GETCORECLOCK,          /**< Cy_USER_SysGetCoreClock */
+    CY_USER_SYSPM_OP_GETRESIDENCY,          /**< Cy_USER_SysGetResidency */
+    CY_USER_SYSPM_OP_SETTELEMETRYPAGE,      /**< Cy_USER_SysSetTelemetryPage */
+    CY_USER_SYSPM_OP_GETSTATE,              /**< Cy_USER_SysGetState */
     CY_USER_SYSPM_OP_MAX
 } cy_user_syspm_srf_op_id_t;
 
+/** Retention and wake-up configuration for the deeper sleep states. */
+typedef struct
+{
+    uint32_t sram_retain_mask;  /**< SRAM macros to keep retained, see CY_USER_SYSPM_SRAM_ALL_MACROS.
+                                     Protected macros are always retained. Used by DS-RAM. */
+    uint32_t socmem_retain;     /**< Non-zero keeps SOCMEM retained. Used by DS-RAM. */
+    uint32_t wakeup_src;        /**< Hibernate wake-up sources (cy_en_syspm_hibernate_wakeup_source_t mask).
+                                     Used by DS-OFF and Hibernate, other bits are rejected with
+                                     CY_USER_SYSPM_BAD_PARAM. DS-RAM wakes on any enabled interrupt. */
+} cy_stc_user_syspm_ds_cfg_t;
+
+/** Number of backup-domain words kept for the non-secure side */
+#define CY_USER_SYSPM_BACKUP_WORDS      (8U)
+
+/** Words kept in the backup-domain registers. They survive DS-OFF and Hibernate
+ * and are only cleared by a power-on or an external reset. */
+typedef struct
+{
+    uint32_t words[CY_USER_SYSPM_BACKUP_WORDS];     /**< Backup register contents */
+} cy_stc_user_syspm_backup_t;
+
+/** Deep Sleep depth of each power domain, applied on the next Deep Sleep entry.
+ * Each member is a cy_en_syspm_deep_sleep_mode_t value: CY_SYSPM_MODE_DEEPSLEEP,
+ * CY_SYSPM_MODE_DEEPSLEEP_RAM or CY_SYSPM_MODE_DEEPSLEEP_OFF. */
+typedef struct
+{
+    uint32_t sys_mode;          /**< System domain */
+    uint32_t app_mode;          /**< Application (CM55) domain */
+    uint32_t socmem_mode;       /**< System SRAM (SOCMEM) */
+} cy_stc_user_syspm_ds_modes_t;
+
+/** Expected wake-up latency of each power domain for the selected Deep Sleep depth. */
+typedef struct
+{
+    uint32_t sys_wakeup_us;     /**< System domain wake-up latency in microseconds */
+    uint32_t app_wakeup_us;     /**< Application domain wake-up latency in microseconds */
+    uint32_t socmem_wakeup_us;  /**< SOCMEM wake-up latency in microseconds */
+} cy_stc_user_syspm_ds_latency_t;
+
+/** SRAM macro power configuration, see CY_USER_SYSPM_SRAM_ALL_MACROS for the bit layout. */
+typedef struct
+{
+    uint32_t active_mask;       /**< Macros powered in HP, LP and ULP, the others are powered off */
+    uint32_t ds_retain_mask;    /**< Macros retained in Deep Sleep, must be a subset of active_mask */
+} cy_stc_user_syspm_sram_cfg_t;
+
+/** Result of a CM55 power-on request. */
+typedef struct
+{
+    uint32_t restart_us;        /**< Time from the request to the CM55 release from reset, in microseconds */
+    uint32_t validated;         /**< Non-zero if the boot image was validated by this request,
+                                     zero if the cached validation result was used */
+} cy_stc_user_syspm_cm55_restart_t;
+
+/** System power modes of the CM33. */
+typedef enum
+{
+    CY_USER_SYSPM_MODE_HP,      /**< System High Performance */
+    CY_USER_SYSPM_MODE_LP,      /**< System Low Power */
+    CY_USER_SYSPM_MODE_ULP      /**< System Ultra Low Power */
+} cy_en_user_syspm_mode_t;
+
+/** Index of Deep Sleep in the residency arrays, after the cy_en_user_syspm_mode_t modes. */
+#define CY_USER_SYSPM_RESIDENCY_DS           (3U)
+
+/** Number of states tracked by the residency counters: HP, LP, ULP and Deep Sleep. */
+#define CY_USER_SYSPM_RESIDENCY_STATES       (4U)
+
+/** Time spent in each power state and the charge estimated from it. The
+ * arrays are indexed by cy_en_user_syspm_mode_t, Deep Sleep is at
+ * CY_USER_SYSPM_RESIDENCY_DS and covers DS and DS-RAM. */
+typedef struct
+{
+    uint64_t residency_us[CY_USER_SYSPM_RESIDENCY_STATES];  /**< Time spent in the state, in microseconds */
+    uint32_t entries[CY_USER_SYSPM_RESIDENCY_STATES];       /**< Number of transitions into the state */
+    uint32_t current_ua[CY_USER_SYSPM_RESIDENCY_STATES];    /**< Board current model used for the estimate,
+                                                                 in microamperes */
+    uint64_t charge_uc;         /**< Estimated charge drawn by the device, in microcoulombs */
+    uint32_t failures;          /**< Transitions refused or aborted by the device */
+    uint32_t discarded;         /**< Intervals not accounted because the LPTimer counter went backwards */
+} cy_stc_user_syspm_residency_t;
+
+/** Identifies an initialized telemetry page. */
+#define CY_USER_SYSPM_TELEMETRY_MAGIC        (0x544C4D59UL)
+
+/** Layout version of cy_stc_user_syspm_telemetry_t, incremented when it changes. */
+#define CY_USER_SYSPM_TELEMETRY_VERSION      (1UL)
+
+/** Power state published by the secure side after every change. */
+typedef struct
+{
+    uint32_t mode;              /**< System power mode, cy_en_user_syspm_mode_t */
+    uint32_t core_hz;           /**< CM33 clock frequency in Hz */
+    uint32_t clkhf0_hz;         /**< CLKHF0 frequency in Hz */
+    uint32_t rram_vmode;        /**< RRAM voltage mode, cy_en_rram_vmode_t */
+    uint32_t transitions;       /**< Successful HP, LP and ULP transitions since reset */
+    uint32_t ds_entries;        /**< Deep Sleep and Deep Sleep RAM entries since reset */
+    uint32_t updated;           /**< CM33 LPTimer count at the last update */
+    uint32_t reserved;
+} cy_stc_user_syspm_telemetry_t;
+
+/** Telemetry page in non-secure shared memory, written only by the secure
+ * side. The state is kept twice: the secure side updates one copy while the
+ * low bit of seq sends readers to the other one, so a reader that interrupts
+ * the update still gets a consistent copy without waiting. */
+typedef struct
+{
+    uint32_t magic;             /**< CY_USER_SYSPM_TELEMETRY_MAGIC once published */
+    uint32_t version;           /**< CY_USER_SYSPM_TELEMETRY_VERSION of the secure side */
+    uint32_t size;              /**< Size of one copy in bytes */
+    uint32_t seq;               /**< Incremented before each copy is written */
+    cy_stc_user_syspm_telemetry_t copy[2];
+} cy_stc_user_syspm_telemetry_page_t;
+
+/** Power and clock state of the device, read in a single request. */
+typedef struct
+{
+    uint32_t mode;              /**< System power mode, cy_en_user_syspm_mode_t */
+    uint32_t core_hz;           /**< CM33 clock frequency in Hz */
+    uint32_t clkhf0_div;        /**< CLKHF0 divider, cy_en_clkhf_dividers_t */
+    uint32_t clkhf0_hz;         /**< CLKHF0 frequency in Hz */
+    uint32_t dpll_hz;           /**< DPLL_LP0 output frequency in Hz, zero when disabled */
+    uint32_t rram_vmode;        /**< RRAM voltage mode, cy_en_rram_vmode_t */
+    cy_stc_user_syspm_ds_modes_t ds_modes;  /**< Deep Sleep depth applied to each domain on the next entry */
+    uint32_t se_enabled;        /**< Non-zero while the Secure Enclave is enabled */
+} cy_stc_user_syspm_state_t;
+
+#if !defined(COMPONENT_SECURE_DEVICE)
+/** Events delivered to the transition notifiers. */
+typedef enum
+{
+    CY_USER_SYSPM_NOTIFY_PREPARE,   /**< The transition is about to be requested, can be refused */
+    CY_USER_SYSPM_NOTIFY_COMMIT,    /**< The device is in the new mode, the clocks are updated */
+    CY_USER_SYSPM_NOTIFY_ABORT      /**< The transition was refused or failed, the mode is unchanged */
+} cy_en_user_syspm_notify_event_t;
+
+/** Power mode transition reported to the notifiers. */
+typedef struct
+{
+    cy_en_user_syspm_mode_t from;   /**< Mode before the transition */
+    cy_en_user_syspm_mode_t to;     /**< Requested mode */
+} cy_stc_user_syspm_transition_t;
+
+/** Transition notifier handler. The return value is only used for
+ * CY_USER_SYSPM_NOTIFY_PREPARE, anything but CY_USER_SYSPM_SUCCESS refuses
+ * the transition. */
+typedef cy_en_user_syspm_status_t (*cy_user_syspm_notify_handler_t)(cy_en_user_syspm_notify_event_t event,
+                                                                    const cy_stc_user_syspm_transition_t* transition,
+                                                                    void* arg);
+
+/** Transition notifier. The handler time is measured with the CPU cycle
+ * counter and accumulated per notifier. */
+typedef struct cy_stc_user_syspm_notifier
+{
+    cy_user_syspm_notify_handler_t      handler;    /**< Called for every event */
+    void*                               arg;        /**< Passed to the handler */
+    uint32_t                            calls;      /**< Number of handler calls */
+    uint32_t                            total_us;   /**< Time spent in the handler, in microseconds */
+    uint32_t                            max_us;     /**< Longest handler call, in microseconds */
+    struct cy_stc_user_syspm_notifier*  next;       /**< Set by the bus */
+    struct cy_stc_user_syspm_notifier*  prev;       /**< Set by the bus */
+} cy_stc_user_syspm_notifier_t;
+#endif /* !defined(COMPONENT_SECURE_DEVICE) */
+
 
 #if defined(COMPONENT_SECURE_DEVICE)
 /** Array of SYSPM Secure Operations */
@@ -114,3 +307,347 @@ cy_en_user_syspm_status_t Cy_USER_SysEnterUlp(void);
 *
 *******************************************************************************/
 cy_en_user_syspm_status_t Cy_USER_SysEnterDS(void);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysEnterDSRam
+****************************************************************************//**
+*
+* Sets device into System Deep Sleep RAM mode. SRAM macros not selected in the
+* configuration are powered off for the duration of the sleep, and their
+* contents are lost.
+*
+* \param config
+* Memory retention configuration.
+
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysEnterDSRam(const cy_stc_user_syspm_ds_cfg_t* config);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysEnterDSOff
+****************************************************************************//**
+*
+* Sets device into System Deep Sleep OFF mode. The device wakes up through a
+* reset, so this function only returns on failure.
+*
+* \param config
+* Wake-up source configuration.
+
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysEnterDSOff(const cy_stc_user_syspm_ds_cfg_t* config);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysEnterHibernate
+****************************************************************************//**
+*
+* Sets device into System Hibernate mode. The device wakes up through a reset,
+* so this function only returns on failure.
+*
+* \param config
+* Wake-up source configuration.
+
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysEnterHibernate(const cy_stc_user_syspm_ds_cfg_t* config);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysSetBackup
+****************************************************************************//**
+*
+* Writes the backup-domain words kept for the non-secure side, e.g. a record
+* read back after a wake-up from DS-OFF or Hibernate.
+*
+* \param backup
+* Words to write.
+*
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysSetBackup(const cy_stc_user_syspm_backup_t* backup);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysGetBackup
+****************************************************************************//**
+*
+* Reads the backup-domain words kept for the non-secure side.
+*
+* \param backup
+* Returns the words.
+*
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysGetBackup(cy_stc_user_syspm_backup_t* backup);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysSetDeepSleepModes
+****************************************************************************//**
+*
+* Sets the Deep Sleep depth of the system, application and SOCMEM domains
+* independently. The depths are used by the next Cy_USER_SysEnterDS call and
+* stay in effect until changed again. With the system domain in
+* CY_SYSPM_MODE_DEEPSLEEP_OFF, the wake-up goes through a reset.
+*
+* \param modes
+* Deep Sleep depth of each domain.
+*
+* \param latency
+* Returns the expected wake-up latency of each domain. Can be NULL.
+
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysSetDeepSleepModes(const cy_stc_user_syspm_ds_modes_t* modes,
+                                                       cy_stc_user_syspm_ds_latency_t* latency);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysSetSramPower
+****************************************************************************//**
+*
+* Powers off the SRAM macros the application does not use, and selects the
+* macros retained in Deep Sleep. Macros holding the extended boot area, the
+* secure image or the SRF shared memory pool are protected, and a request
+* that powers off any of them is rejected. Contents of a powered off macro are
+* lost.
+*
+* \param config
+* SRAM macro power configuration.
+*
+* \param protected_mask
+* Returns the mask of protected SRAM macros. Can be NULL.
+
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysSetSramPower(const cy_stc_user_syspm_sram_cfg_t* config,
+                                                  uint32_t* protected_mask);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysCm55PowerOff
+****************************************************************************//**
+*
+* Holds the CM55 in reset and sets the Deep Sleep depth of the application
+* domain to CY_SYSPM_MODE_DEEPSLEEP_OFF, so that the domain is powered off
+* instead of retained. The CM55 must be idle, its state is lost.
+*
+* \param none
+*
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysCm55PowerOff(void);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysCm55PowerOn
+****************************************************************************//**
+*
+* Restores the Deep Sleep depth of the application domain and starts the CM55
+* from its boot image. The image is validated on the first request and the
+* result is cached, later requests restart the CM55 without validating it again.
+* Does nothing if the CM55 is already running.
+*
+* \param wait_us
+* Time to wait for the CM55 to start, in microseconds, or
+* CY_SYS_CORE_WAIT_INFINITE.
+*
+* \param restart
+* Returns the restart latency and whether the image was validated. Can be NULL.
+*
+* \return
+* Status of the request. CY_USER_SYSPM_FAIL if the boot image is not valid.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysCm55PowerOn(uint32_t wait_us, cy_stc_user_syspm_cm55_restart_t* restart);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysGetCoreClock
+****************************************************************************//**
+*
+* Returns the CM33 clock frequency, which changes with the system power mode.
+* The clock configuration is read on the secure side. On the non-secure side
+* Cy_USER_SysEnterHp, Cy_USER_SysEnterLp and Cy_USER_SysEnterUlp call it after
+* every transition to update SystemCoreClock, the Cy_SysLib_Delay calibration
+* and the SysTick reload.
+*
+* \param hz
+* Returns the clock frequency in Hz.
+*
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysGetCoreClock(uint32_t* hz);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysGetResidency
+****************************************************************************//**
+*
+* Returns the time spent in each power state since the counters were last
+* cleared, the number of transitions into each state and the charge estimated
+* from the board current model. The secure side accounts the time with the
+* free-running CM33 LPTimer, which keeps counting in Deep Sleep; time before
+* the non-secure application starts it is not accounted, so the counters should
+* be cleared once it runs. The counters start over after DS-OFF and Hibernate,
+* which wake up through reset.
+*
+* The LPTimer is owned by the non-secure side, which can stop, reset or
+* reconfigure it, so the figures are only as reliable as the non-secure
+* application and must not be used for security decisions. An interval over
+* which the counter went backwards, after a reset or the wrap of the counter
+* every 36 hours, is not accounted and is counted in discarded instead.
+* The charge is estimated from placeholder currents, see RESIDENCY_CURRENT_UA
+* in user_syspm_srf.c.
+*
+* \param residency
+* Returns the counters, may be NULL when only clearing them.
+*
+* \param clear
+* Clears the counters after reading them.
+*
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysGetResidency(cy_stc_user_syspm_residency_t* residency, bool clear);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysSetTelemetryPage
+****************************************************************************//**
+*
+* Registers the page the secure side publishes the power state to. The page
+* must be in non-secure memory; it is initialized and published immediately,
+* then after every power mode transition and Deep Sleep wake-up.
+*
+* \param page
+* Telemetry page, NULL stops the publishing.
+*
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysSetTelemetryPage(cy_stc_user_syspm_telemetry_page_t* page);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysGetState
+****************************************************************************//**
+*
+* Returns the system power mode, the CM33, CLKHF0 and DPLL frequencies, the
+* CLKHF0 divider, the RRAM voltage mode, the Deep Sleep depth of each domain
+* and the Secure Enclave state, all read by the secure side in one request.
+* The Deep Sleep depth of the application domain is Deep Sleep OFF while the
+* CM55 is powered off.
+*
+* \param state
+* Returns the state.
+*
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysGetState(cy_stc_user_syspm_state_t* state);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysGetPowerMode
+****************************************************************************//**
+*
+* Returns the current system power mode. On the non-secure side this is the
+* mode set by the last successful Cy_USER_SysEnterHp, Cy_USER_SysEnterLp or
+* Cy_USER_SysEnterUlp call, so no secure request is needed.
+*
+* \param none
+*
+* \return
+* Current system power mode.
+*
+*******************************************************************************/
+cy_en_user_syspm_mode_t Cy_USER_SysGetPowerMode(void);
+
+#if !defined(COMPONENT_SECURE_DEVICE)
+/*******************************************************************************
+* Function Name: Cy_USER_SysTelemetryInit
+****************************************************************************//**
+*
+* Registers the telemetry page held in CY_SECTION_SHAREDMEM with the secure
+* side. Call it once after cy_user_srf_module_pool_init.
+*
+* \return
+* Status of the request.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysTelemetryInit(void);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysReadTelemetry
+****************************************************************************//**
+*
+* Reads a consistent copy of the power state published by the secure side,
+* without a secure request. Can be called from interrupts.
+*
+* \param telemetry
+* Returns the power state.
+*
+* \return
+* false if the page is not registered or was changed during every attempt.
+*
+*******************************************************************************/
+bool Cy_USER_SysReadTelemetry(cy_stc_user_syspm_telemetry_t* telemetry);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysRegisterNotifier
+****************************************************************************//**
+*
+* Subscribes a notifier to the HP, LP and ULP transitions. For every transition
+* the notifiers receive CY_USER_SYSPM_NOTIFY_PREPARE in registration order,
+* before the request is sent to the secure side. If all of them accept, the
+* request is sent and they receive CY_USER_SYSPM_NOTIFY_COMMIT in reverse order
+* on success. If a notifier refuses or the request fails, the notifiers that
+* were prepared, including the one that refused, receive
+* CY_USER_SYSPM_NOTIFY_ABORT in reverse order.
+*
+* The CM33 waits for the secure side while it changes the clocks. A prepare
+* handler should only start work that completes by itself, such as a FIFO or
+* DMA drain, so that it overlaps the secure transition, and wait for it in the
+* commit or abort handler.
+*
+* Handlers run in the context of the caller of the transition and must not
+* request another transition.
+*
+* \param notifier
+* Notifier with its handler set. Must stay valid while registered.
+*
+* \return
+* Status of the request. CY_USER_SYSPM_BAD_PARAM if the notifier has no
+* handler or is already registered.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysRegisterNotifier(cy_stc_user_syspm_notifier_t* notifier);
+
+/*******************************************************************************
+* Function Name: Cy_USER_SysUnregisterNotifier
+****************************************************************************//**
+*
+* Removes a notifier registered with Cy_USER_SysRegisterNotifier. Must not be
+* called from a handler.
+*
+* \param notifier
+* Registered notifier.
+*
+* \return
+* Status of the request. CY_USER_SYSPM_BAD_PARAM if the notifier is not
+* registered.
+*
+*******************************************************************************/
+cy_en_user_syspm_status_t Cy_USER_SysUnregisterNotifier(cy_stc_user_syspm_notifier_t* notifier);
+#endif /* !defined(COMPONENT_SECURE_DEVICE) */